@@ -0,0 +1,191 @@
+
+#include "baseline.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <stdexcept>
+
+#include "input.h"
+
+namespace {
+
+    constexpr double NANOSECONDS = 1e9;
+
+    // Scales a MAD to a standard deviation estimate for normally distributed samples.
+    constexpr double MAD_TO_SIGMA = 1.4826;
+
+    std::string toString(baseline::Verdict verdict) {
+        switch (verdict) {
+            case baseline::Verdict::Unchanged:
+                return "ok";
+            case baseline::Verdict::Improved:
+                return "improved";
+            case baseline::Verdict::Regressed:
+                return "REGRESSED";
+            case baseline::Verdict::Missing:
+                return "no baseline";
+        }
+        throw std::runtime_error("Unknown verdict");
+    }
+
+}
+
+namespace baseline {
+
+    void checkWritable(const std::string &path) {
+        std::ofstream file(path, std::ios::app);
+        if (!file) {
+            throw std::ios_base::failure("Cannot open results file: " + path);
+        }
+    }
+
+    void save(const std::string &path, const std::string &baselineName, const std::string &commit,
+              const std::vector<bench::Result> &results) {
+        std::ofstream file(path, std::ios::app);
+        if (!file) {
+            throw std::ios_base::failure("Cannot open results file: " + path);
+        }
+        auto timestamp = static_cast<long long>(std::time(nullptr));
+
+        file << std::fixed << std::setprecision(0);
+        for (const auto &result: results) {
+            if (!result.error.empty()) {
+                continue;
+            }
+            file << baselineName << '\t' << commit << '\t' << timestamp << '\t' << result.name << '\t'
+                 << result.stats.median * NANOSECONDS << '\t' << result.stats.mad * NANOSECONDS << '\t'
+                 << result.stats.min * NANOSECONDS << '\t' << result.stats.samples << '\n';
+        }
+    }
+
+    std::vector<Record> load(const std::string &path, const std::string &baselineNameOrCommit) {
+        std::ifstream file(path);
+        if (!file) {
+            throw std::ios_base::failure("Cannot open results file: " + path);
+        }
+
+        // Later lines overwrite earlier ones, so the latest save of a benchmark wins.
+        std::map<std::string, Record> latest{};
+        for (const auto &line: input::readLines(file)) {
+            auto fields = input::split(line, '\t');
+            if (fields.size() != 8) {
+                continue;
+            }
+            if (fields[0] != baselineNameOrCommit && fields[1] != baselineNameOrCommit) {
+                continue;
+            }
+            Record record{};
+            try {
+                record = Record{
+                        .baselineName = fields[0],
+                        .commit = fields[1],
+                        .timestamp = std::stoll(fields[2]),
+                        .name = fields[3],
+                        .stats = bench::Stats{
+                                .median = std::stod(fields[4]) / NANOSECONDS,
+                                .mad = std::stod(fields[5]) / NANOSECONDS,
+                                .min = std::stod(fields[6]) / NANOSECONDS,
+                                .samples = std::stoul(fields[7])}};
+            } catch (const std::invalid_argument &) {
+                continue;
+            } catch (const std::out_of_range &) {
+                continue;
+            }
+            latest[record.name] = record;
+        }
+
+        std::vector<Record> records{};
+        for (auto &[name, record]: latest) {
+            records.push_back(record);
+        }
+        return records;
+    }
+
+    std::string currentCommit() {
+        std::unique_ptr<FILE, decltype(&pclose)> pipe(popen("git rev-parse --short HEAD 2>/dev/null", "r"), pclose);
+        if (!pipe) {
+            return "unknown";
+        }
+        std::array<char, 64> buffer{};
+        std::string commit{};
+        while (std::fgets(buffer.data(), static_cast<int>(buffer.size()), pipe.get()) != nullptr) {
+            commit += buffer.data();
+        }
+        input::trim(commit);
+        return commit.empty() ? "unknown" : commit;
+    }
+
+    std::vector<Comparison> compare(const std::vector<Record> &baselineRecords,
+                                    const std::vector<bench::Result> &results, const GateOptions &options) {
+        std::vector<Comparison> comparisons{};
+
+        for (const auto &result: results) {
+            auto recordIt = std::find_if(baselineRecords.begin(), baselineRecords.end(), [&result](const Record &record) {
+                return record.name == result.name;
+            });
+
+            Comparison comparison{.name = result.name, .currentMedian = result.stats.median};
+            if (recordIt == baselineRecords.end()) {
+                comparison.verdict = Verdict::Missing;
+                comparisons.push_back(comparison);
+                continue;
+            }
+            const auto &base = recordIt->stats;
+            comparison.baselineMedian = base.median;
+
+            if (!result.error.empty()) {
+                // It used to work.
+                comparison.verdict = Verdict::Regressed;
+                comparisons.push_back(comparison);
+                continue;
+            }
+
+            double sigma = MAD_TO_SIGMA * std::sqrt(base.mad * base.mad + result.stats.mad * result.stats.mad);
+            comparison.allowedDelta = std::max({options.relativeThreshold * base.median, options.sigmas * sigma,
+                                                options.minimumDelta});
+
+            double delta = result.stats.median - base.median;
+            if (delta > comparison.allowedDelta) {
+                comparison.verdict = Verdict::Regressed;
+            } else if (-delta > comparison.allowedDelta) {
+                comparison.verdict = Verdict::Improved;
+            } else {
+                comparison.verdict = Verdict::Unchanged;
+            }
+            comparisons.push_back(comparison);
+        }
+        return comparisons;
+    }
+
+    void printComparison(std::ostream &out, const std::vector<Comparison> &comparisons) {
+        constexpr double milliseconds = 1e3;
+
+        out << std::left << std::setw(16) << "benchmark" << std::right
+            << std::setw(14) << "base [ms]" << std::setw(14) << "now [ms]" << std::setw(10) << "change"
+            << "  verdict\n";
+        out << std::fixed << std::setprecision(4);
+        for (const auto &comparison: comparisons) {
+            out << std::left << std::setw(16) << comparison.name << std::right
+                << std::setw(14) << comparison.baselineMedian * milliseconds
+                << std::setw(14) << comparison.currentMedian * milliseconds;
+
+            if (comparison.verdict == Verdict::Missing || comparison.baselineMedian == 0.0) {
+                out << std::setw(10) << "-";
+            } else {
+                double change = (comparison.currentMedian / comparison.baselineMedian - 1.0) * 100.0;
+                out << std::setw(9) << std::setprecision(1) << std::showpos << change << std::noshowpos << '%'
+                    << std::setprecision(4);
+            }
+            out << "  " << toString(comparison.verdict) << "\n";
+        }
+        out << std::defaultfloat;
+    }
+
+}
@@ -0,0 +1,73 @@
+
+#ifndef AOC_2023_BASELINE_H
+#define AOC_2023_BASELINE_H
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "benchmark.h"
+
+/**
+ * Local store of benchmark results and the regression gate comparing a run against it.
+ *
+ * Results are appended to a tab-separated file, one line per benchmark:
+ * baseline name, commit, unix time, benchmark name, median/MAD/min in nanoseconds, samples.
+ */
+namespace baseline {
+
+    struct Record {
+        std::string baselineName;
+        std::string commit;
+        long long timestamp{};
+        std::string name;
+        bench::Stats stats;
+    };
+
+    /**
+     * Throws std::ios_base::failure when the file cannot be opened for appending, so that a run can
+     * fail before benchmarking rather than after.
+     */
+    void checkWritable(const std::string &path);
+
+    void save(const std::string &path, const std::string &baselineName, const std::string &commit,
+              const std::vector<bench::Result> &results);
+
+    /**
+     * The latest record of every benchmark saved under the given baseline name or commit. Lines
+     * that do not parse are skipped. Throws std::ios_base::failure when the file cannot be opened.
+     */
+    std::vector<Record> load(const std::string &path, const std::string &baselineNameOrCommit);
+
+    /**
+     * HEAD of the git repository the benchmark runs in, "unknown" outside of one.
+     */
+    std::string currentCommit();
+
+    struct GateOptions {
+        // Slowdowns smaller than this fraction of the baseline median are tolerated.
+        double relativeThreshold = 0.05;
+        // ...and so are slowdowns within this many combined standard deviations (estimated from the MADs).
+        double sigmas = 3.0;
+        // Absolute floor in seconds, so that sub-microsecond benchmarks do not flap.
+        double minimumDelta = 1e-6;
+    };
+
+    enum class Verdict { Unchanged, Improved, Regressed, Missing };
+
+    struct Comparison {
+        std::string name;
+        double baselineMedian{};
+        double currentMedian{};
+        double allowedDelta{};
+        Verdict verdict{};
+    };
+
+    std::vector<Comparison> compare(const std::vector<Record> &baselineRecords,
+                                    const std::vector<bench::Result> &results, const GateOptions &options);
+
+    void printComparison(std::ostream &out, const std::vector<Comparison> &comparisons);
+
+}
+
+#endif
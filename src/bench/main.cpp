@@ -0,0 +1,194 @@
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "baseline.h"
+#include "benchmark.h"
+#include "input.h"
+#include "profiling.h"
+#include "scaling.h"
+
+namespace {
+
+struct InputArgs {
+    bench::Options options;
+    std::string jsonPath;
+    std::string resultsPath{"bench_results.tsv"};
+    std::string saveAs;
+    std::string commit;
+    std::string compareWith;
+    baseline::GateOptions gateOptions;
+    bool scaling;
+    scaling::Options scalingOptions;
+    std::string csvPath;
+    bool areInvalid;
+};
+
+void printUsage() {
+    std::cout << "Usage: aoc_bench [--warmup=N] [--repetitions=N] [--filter=TEXT] [--input-dir=DIR]\n"
+                 "                 [--json=FILE] [--include-disabled] [--embedded]\n"
+                 "                 [--results=FILE] [--save=NAME] [--commit=ID]\n"
+                 "                 [--compare=NAME|COMMIT] [--threshold=FRACTION] [--sigmas=N]\n"
+                 "       aoc_bench --scaling [--sizes=1,2,4,8] [--threads=1,2,4] [--seed=N]\n"
+                 "                 [--scaling-dir=DIR] [--csv=FILE] [--warmup=N] [--repetitions=N] [--filter=TEXT]\n";
+}
+
+InputArgs parseArguments(int argc, char *argv[]) {
+    InputArgs args{};
+    try {
+        for (int i = 1; i < argc; i++) {
+            std::string_view arg{argv[i]};
+            auto value = [&arg]() {
+                return std::string(arg.substr(arg.find('=') + 1));
+            };
+
+            if (arg.starts_with("--warmup=")) {
+                args.options.warmup = std::stoi(value());
+            } else if (arg.starts_with("--repetitions=")) {
+                args.options.repetitions = std::stoi(value());
+            } else if (arg.starts_with("--filter=")) {
+                args.options.filter = value();
+            } else if (arg.starts_with("--input-dir=")) {
+                args.options.inputDirectory = value();
+            } else if (arg == "--embedded") {
+                args.options.embedded = true;
+            } else if (arg.starts_with("--json=")) {
+                args.jsonPath = value();
+            } else if (arg.starts_with("--results=")) {
+                args.resultsPath = value();
+            } else if (arg.starts_with("--save=")) {
+                args.saveAs = value();
+            } else if (arg.starts_with("--commit=")) {
+                args.commit = value();
+            } else if (arg.starts_with("--compare=")) {
+                args.compareWith = value();
+            } else if (arg.starts_with("--threshold=")) {
+                args.gateOptions.relativeThreshold = std::stod(value());
+            } else if (arg.starts_with("--sigmas=")) {
+                args.gateOptions.sigmas = std::stod(value());
+            } else if (arg == "--include-disabled") {
+                args.options.includeDisabled = true;
+            } else if (arg == "--scaling") {
+                args.scaling = true;
+            } else if (arg.starts_with("--sizes=")) {
+                args.scalingOptions.multipliers = input::parseVector<uint64_t>(value(), ',');
+            } else if (arg.starts_with("--threads=")) {
+                args.scalingOptions.threadCounts = input::parseVector<int>(value(), ',');
+            } else if (arg.starts_with("--seed=")) {
+                args.scalingOptions.seed = std::stoull(value());
+            } else if (arg.starts_with("--scaling-dir=")) {
+                args.scalingOptions.workDirectory = value();
+            } else if (arg.starts_with("--csv=")) {
+                args.csvPath = value();
+            } else {
+                args.areInvalid = true;
+            }
+        }
+    } catch (...) {
+        args.areInvalid = true;
+    }
+    if (args.options.warmup < 0 || args.options.repetitions < 1) {
+        args.areInvalid = true;
+    }
+    const auto &counts = args.scalingOptions.threadCounts;
+    if (args.scalingOptions.multipliers.empty() || std::any_of(counts.begin(), counts.end(), [](int count) {
+        return count < 1;
+    })) {
+        args.areInvalid = true;
+    }
+    return args;
+}
+
+int runScaling(const InputArgs &args) {
+    auto points = scaling::run(args.options, args.scalingOptions);
+    scaling::printThroughput(std::cout, points);
+    std::cout << "\n";
+    scaling::printSpeedup(std::cout, points);
+
+    if (!args.csvPath.empty()) {
+        std::ofstream csv(args.csvPath);
+        if (!csv) {
+            std::cerr << "Failed to open " << args.csvPath << std::endl;
+            return EXIT_FAILURE;
+        }
+        scaling::writeCsv(csv, points);
+    }
+    return EXIT_SUCCESS;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+    InputArgs args{parseArguments(argc, argv)};
+    if (args.areInvalid) {
+        std::cout << "Input arguments are invalid." << std::endl;
+        printUsage();
+        return EXIT_FAILURE;
+    }
+    bench::registerSolvers();
+    profiling::calibrateCounter();
+    if (args.scaling) {
+        return runScaling(args);
+    }
+
+    try {
+        // The results file is checked first, so that a bad path does not waste a whole run.
+        std::vector<baseline::Record> records{};
+        if (!args.compareWith.empty()) {
+            records = baseline::load(args.resultsPath, args.compareWith);
+            if (records.empty()) {
+                std::cerr << "No results saved for baseline " << args.compareWith << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+        if (!args.saveAs.empty()) {
+            baseline::checkWritable(args.resultsPath);
+        }
+
+        auto results = bench::runAll(args.options);
+        bench::printTable(std::cout, results);
+
+        if (!args.jsonPath.empty()) {
+            std::ofstream json(args.jsonPath);
+            if (!json) {
+                std::cerr << "Failed to open " << args.jsonPath << std::endl;
+                return EXIT_FAILURE;
+            }
+            bench::writeJson(json, args.options, results);
+        }
+
+        // Compare before saving, so that a run can be gated against and then recorded under the same name.
+        int exitCode = EXIT_SUCCESS;
+        if (!args.compareWith.empty()) {
+            auto comparisons = baseline::compare(records, results, args.gateOptions);
+            std::cout << "\nCompared with " << args.compareWith << " (" << records.front().commit << "):\n";
+            baseline::printComparison(std::cout, comparisons);
+
+            std::string regressed{};
+            for (const auto &comparison: comparisons) {
+                if (comparison.verdict == baseline::Verdict::Regressed) {
+                    regressed += (regressed.empty() ? "" : ", ") + comparison.name;
+                }
+            }
+            if (!regressed.empty()) {
+                std::cerr << "Regressed: " << regressed << std::endl;
+                exitCode = EXIT_FAILURE;
+            }
+        }
+
+        if (!args.saveAs.empty()) {
+            auto commit = args.commit.empty() ? baseline::currentCommit() : args.commit;
+            baseline::save(args.resultsPath, args.saveAs, commit, results);
+            std::cout << "Saved results as " << args.saveAs << " (" << commit << ") to " << args.resultsPath << "\n";
+        }
+        return exitCode;
+    } catch (const std::ios_base::failure &) {
+        std::cerr << "Cannot open results file " << args.resultsPath << std::endl;
+        return EXIT_FAILURE;
+    }
+}
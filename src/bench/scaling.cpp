@@ -0,0 +1,233 @@
+
+#include "scaling.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#include <tbb/global_control.h>
+
+#include "generator.h"
+#include "scheduler.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+    constexpr double MEGABYTE = 1e6;
+
+    /**
+     * Writes the inputs of all days with a generator for the given multiplier. Returns the size
+     * in bytes of each day's input.
+     */
+    std::map<int, uint64_t> generateInputs(const fs::path &directory, uint64_t multiplier, uint64_t seed) {
+        fs::create_directories(directory);
+
+        std::map<int, uint64_t> inputBytes{};
+        for (const auto &generator: generator::generators()) {
+            // Saturates, a product that wrapped around would be a tiny size.
+            auto size = generator.defaultSize != 0 && multiplier > generator.maxSize / generator.defaultSize
+                        ? generator.maxSize
+                        : std::min(generator.defaultSize * multiplier, generator.maxSize);
+            auto path = directory / (bench::dayName(generator.day) + ".txt");
+            {
+                std::ofstream file(path, std::ios::binary);
+                if (!file) {
+                    throw std::ios_base::failure("Cannot write generated input: " + path.string());
+                }
+                generator::generate(generator.day, file, size, seed);
+            }
+            inputBytes[generator.day] = fs::file_size(path);
+        }
+        return inputBytes;
+    }
+
+    /**
+     * "x" and the multiplier. Appended rather than "x" + std::to_string(), on which GCC 12 warns
+     * with -Wrestrict once inlined.
+     */
+    std::string multiplierLabel(uint64_t multiplier) {
+        std::string label = "x";
+        label.append(std::to_string(multiplier));
+        return label;
+    }
+
+    std::string escapeCsv(const std::string &string) {
+        std::string escaped{};
+        for (char character: string) {
+            if (character == '"') {
+                escaped.push_back('"');
+            }
+            escaped.push_back(character);
+        }
+        return escaped;
+    }
+
+    using Row = std::pair<std::string, uint64_t>;
+
+    /**
+     * Groups points by (benchmark, multiplier) in the order they were measured.
+     */
+    std::vector<std::pair<Row, std::vector<const scaling::Point *>>> rows(const std::vector<scaling::Point> &points) {
+        std::vector<std::pair<Row, std::vector<const scaling::Point *>>> grouped{};
+        for (const auto &point: points) {
+            Row row{point.name, point.multiplier};
+            auto it = std::find_if(grouped.begin(), grouped.end(), [&row](const auto &entry) {
+                return entry.first == row;
+            });
+            if (it == grouped.end()) {
+                grouped.emplace_back(row, std::vector<const scaling::Point *>{});
+                it = std::prev(grouped.end());
+            }
+            it->second.push_back(&point);
+        }
+        return grouped;
+    }
+
+    std::vector<int> threadCounts(const std::vector<scaling::Point> &points) {
+        std::set<int> counts{};
+        for (const auto &point: points) {
+            counts.insert(point.threads);
+        }
+        return {counts.begin(), counts.end()};
+    }
+
+    const scaling::Point *findThreads(const std::vector<const scaling::Point *> &row, int threads) {
+        auto it = std::find_if(row.begin(), row.end(), [threads](const scaling::Point *point) {
+            return point->threads == threads && point->error.empty();
+        });
+        return it == row.end() ? nullptr : *it;
+    }
+
+    void printHeader(std::ostream &out, const std::string &title, const std::vector<int> &counts, int width) {
+        out << title << "\n";
+        out << std::left << std::setw(16) << "benchmark" << std::right << std::setw(6) << "size";
+        for (auto count: counts) {
+            out << std::setw(width) << (std::to_string(count) + "T");
+        }
+        out << "\n";
+    }
+
+}
+
+namespace scaling {
+
+    std::vector<int> defaultThreadCounts() {
+        int hardware = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+        std::vector<int> counts{};
+        for (int count = 1; count < hardware; count *= 2) {
+            counts.push_back(count);
+        }
+        counts.push_back(hardware);
+        return counts;
+    }
+
+    std::vector<Point> run(const bench::Options &benchOptions, const Options &options) {
+        auto counts = options.threadCounts.empty() ? defaultThreadCounts() : options.threadCounts;
+
+        std::set<int> generatedDays{};
+        for (const auto &generator: generator::generators()) {
+            generatedDays.insert(generator.day);
+        }
+
+        std::vector<Point> points{};
+        const auto configured = scheduler::options();
+        for (auto multiplier: options.multipliers) {
+            auto directory = fs::path(options.workDirectory) / multiplierLabel(multiplier);
+            std::cerr << "Generating inputs x" << multiplier << " in " << directory.string() << "..." << std::endl;
+            auto inputBytes = generateInputs(directory, multiplier, options.seed);
+
+            bench::Options runOptions = benchOptions;
+            runOptions.inputDirectory = directory.string();
+
+            for (auto threads: counts) {
+                tbb::global_control parallelism(tbb::global_control::max_allowed_parallelism,
+                                                static_cast<size_t>(threads));
+                scheduler::configure({.concurrency = threads, .deterministic = configured.deterministic});
+                std::cerr << "Running with " << threads << " threads" << std::endl;
+
+                for (auto &result: bench::runAll(runOptions)) {
+                    if (!generatedDays.contains(result.day)) {
+                        continue;
+                    }
+                    points.push_back(Point{
+                            .name = result.name, .multiplier = multiplier, .inputBytes = inputBytes[result.day],
+                            .threads = threads, .stats = result.stats, .error = result.error});
+                }
+            }
+        }
+        scheduler::configure(configured);
+        return points;
+    }
+
+    void printThroughput(std::ostream &out, const std::vector<Point> &points) {
+        auto counts = threadCounts(points);
+        printHeader(out, "Throughput [MB/s]", counts, 12);
+
+        out << std::fixed << std::setprecision(2);
+        for (const auto &[row, measured]: rows(points)) {
+            out << std::left << std::setw(16) << row.first << std::right << std::setw(6)
+                << multiplierLabel(row.second);
+            for (auto count: counts) {
+                auto point = findThreads(measured, count);
+                if (point == nullptr || point->stats.median <= 0.0) {
+                    out << std::setw(12) << "-";
+                } else {
+                    out << std::setw(12) << static_cast<double>(point->inputBytes) / MEGABYTE / point->stats.median;
+                }
+            }
+            out << "\n";
+        }
+        out << std::defaultfloat;
+    }
+
+    void printSpeedup(std::ostream &out, const std::vector<Point> &points) {
+        auto counts = threadCounts(points);
+        printHeader(out, "Speedup (parallel efficiency)", counts, 16);
+
+        out << std::fixed;
+        for (const auto &[row, measured]: rows(points)) {
+            out << std::left << std::setw(16) << row.first << std::right << std::setw(6)
+                << multiplierLabel(row.second);
+
+            auto base = findThreads(measured, counts.front());
+            for (auto count: counts) {
+                auto point = findThreads(measured, count);
+                if (base == nullptr || point == nullptr || point->stats.median <= 0.0) {
+                    out << std::setw(16) << "-";
+                    continue;
+                }
+                double speedup = base->stats.median / point->stats.median;
+                double efficiency = speedup * counts.front() / count;
+
+                std::ostringstream cell{};
+                cell << std::fixed << std::setprecision(2) << speedup << "x ("
+                     << std::setprecision(0) << efficiency * 100.0 << "%)";
+                out << std::setw(16) << cell.str();
+            }
+            out << "\n";
+        }
+        out << std::defaultfloat;
+    }
+
+    void writeCsv(std::ostream &out, const std::vector<Point> &points) {
+        constexpr double nanoseconds = 1e9;
+
+        out << "benchmark,multiplier,input_bytes,threads,median_ns,mad_ns,min_ns,samples,error\n";
+        out << std::fixed << std::setprecision(0);
+        for (const auto &point: points) {
+            out << point.name << ',' << point.multiplier << ',' << point.inputBytes << ',' << point.threads << ','
+                << point.stats.median * nanoseconds << ',' << point.stats.mad * nanoseconds << ','
+                << point.stats.min * nanoseconds << ',' << point.stats.samples << ",\"" << escapeCsv(point.error) << "\"\n";
+        }
+        out << std::defaultfloat;
+    }
+
+}
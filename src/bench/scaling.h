@@ -0,0 +1,57 @@
+
+#ifndef AOC_2023_SCALING_H
+#define AOC_2023_SCALING_H
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "benchmark.h"
+
+/**
+ * Scaling study: runs the benchmarks on generated inputs of growing size, each of them with
+ * TBB limited to a growing number of threads (tbb::global_control also bounds std::execution::par,
+ * which runs on TBB). Only days with an input generator take part.
+ */
+namespace scaling {
+
+    struct Options {
+        // Each day's default generator size is multiplied by these, see aoc_generate --list.
+        std::vector<uint64_t> multipliers{1, 2, 4, 8};
+        // Defaults to powers of two up to the hardware concurrency, and the hardware concurrency itself.
+        std::vector<int> threadCounts{};
+        uint64_t seed = 1;
+        // Generated inputs are written to <workDirectory>/x<multiplier>/dayNN.txt.
+        std::string workDirectory{"scaling_inputs"};
+    };
+
+    std::vector<int> defaultThreadCounts();
+
+    struct Point {
+        std::string name;
+        uint64_t multiplier{};
+        uint64_t inputBytes{};
+        int threads{};
+        bench::Stats stats;
+        std::string error{};
+    };
+
+    std::vector<Point> run(const bench::Options &benchOptions, const Options &options);
+
+    /**
+     * Input megabytes per second of every benchmark and input size, one column per thread count.
+     */
+    void printThroughput(std::ostream &out, const std::vector<Point> &points);
+
+    /**
+     * Speedup against the smallest thread count and parallel efficiency (speedup divided by
+     * the increase in threads), one column per thread count.
+     */
+    void printSpeedup(std::ostream &out, const std::vector<Point> &points);
+
+    void writeCsv(std::ostream &out, const std::vector<Point> &points);
+
+}
+
+#endif
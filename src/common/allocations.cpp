@@ -0,0 +1,211 @@
+
+#include "allocations.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+    std::atomic<uint64_t> allocationCount{0};
+    std::atomic<uint64_t> deallocationCount{0};
+    std::atomic<uint64_t> allocatedBytes{0};
+    std::atomic<uint64_t> liveBytes{0};
+    std::atomic<uint64_t> peakLiveBytes{0};
+
+}
+
+namespace allocations {
+
+    Stats snapshot() {
+        return Stats{
+                .allocations = allocationCount.load(std::memory_order_relaxed),
+                .deallocations = deallocationCount.load(std::memory_order_relaxed),
+                .bytes = allocatedBytes.load(std::memory_order_relaxed),
+                .liveBytes = liveBytes.load(std::memory_order_relaxed),
+                .peakLiveBytes = peakLiveBytes.load(std::memory_order_relaxed)};
+    }
+
+    Phase::Phase() {
+        reset();
+    }
+
+    void Phase::reset() {
+        peakLiveBytes.store(liveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        m_begin = snapshot();
+    }
+
+    Stats Phase::stats() const {
+        auto now = snapshot();
+        return Stats{
+                .allocations = now.allocations - m_begin.allocations,
+                .deallocations = now.deallocations - m_begin.deallocations,
+                .bytes = now.bytes - m_begin.bytes,
+                .liveBytes = now.liveBytes,
+                .peakLiveBytes = std::max(now.peakLiveBytes, m_begin.liveBytes) - m_begin.liveBytes};
+    }
+
+    std::ostream &operator<<(std::ostream &out, const Phase &phase) {
+        if constexpr (isTrackingEnabled()) {
+            auto stats = phase.stats();
+            out << ", " << stats.allocations << " allocations (" << stats.bytes << " bytes, peak "
+                << stats.peakLiveBytes << " bytes live)";
+        }
+        return out;
+    }
+
+}
+
+#ifdef AOC_TRACK_ALLOCATIONS
+
+namespace {
+
+    // Every block is prefixed with a header that remembers the requested size, so that
+    // unsized deletes can be accounted for too. The size sits right before the user pointer.
+    constexpr std::size_t DEFAULT_HEADER_SIZE = alignof(std::max_align_t);
+
+    std::size_t headerSize(std::size_t alignment) {
+        return std::max(alignment, DEFAULT_HEADER_SIZE);
+    }
+
+    void recordAllocation(std::size_t size) {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+        allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+        auto live = liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+
+        auto peak = peakLiveBytes.load(std::memory_order_relaxed);
+        while (live > peak && !peakLiveBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+        }
+    }
+
+    void recordDeallocation(std::size_t size) {
+        deallocationCount.fetch_add(1, std::memory_order_relaxed);
+        liveBytes.fetch_sub(size, std::memory_order_relaxed);
+    }
+
+    void *allocate(std::size_t size, std::size_t alignment) {
+        auto header = headerSize(alignment);
+        void *base = nullptr;
+        if (alignment <= DEFAULT_HEADER_SIZE) {
+            base = std::malloc(size + header);
+        } else {
+            // aligned_alloc requires the size to be a multiple of the alignment.
+            auto total = (size + header + alignment - 1) / alignment * alignment;
+            base = std::aligned_alloc(alignment, total);
+        }
+        if (base == nullptr) {
+            return nullptr;
+        }
+        auto *user = static_cast<unsigned char *>(base) + header;
+        reinterpret_cast<std::size_t *>(user)[-1] = size;
+        recordAllocation(size);
+        return user;
+    }
+
+    void deallocate(void *pointer, std::size_t alignment) {
+        if (pointer == nullptr) {
+            return;
+        }
+        auto *user = static_cast<unsigned char *>(pointer);
+        recordDeallocation(reinterpret_cast<std::size_t *>(user)[-1]);
+        std::free(user - headerSize(alignment));
+    }
+
+    void *allocateOrThrow(std::size_t size, std::size_t alignment) {
+        while (true) {
+            if (void *pointer = allocate(size, alignment)) {
+                return pointer;
+            }
+            auto handler = std::get_new_handler();
+            if (handler == nullptr) {
+                throw std::bad_alloc();
+            }
+            handler();
+        }
+    }
+
+}
+
+void *operator new(std::size_t size) {
+    return allocateOrThrow(size, DEFAULT_HEADER_SIZE);
+}
+
+void *operator new[](std::size_t size) {
+    return allocateOrThrow(size, DEFAULT_HEADER_SIZE);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment) {
+    return allocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment) {
+    return allocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+    return allocate(size, DEFAULT_HEADER_SIZE);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept {
+    return allocate(size, DEFAULT_HEADER_SIZE);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept {
+    return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept {
+    return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void *pointer) noexcept {
+    deallocate(pointer, DEFAULT_HEADER_SIZE);
+}
+
+void operator delete[](void *pointer) noexcept {
+    deallocate(pointer, DEFAULT_HEADER_SIZE);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept {
+    deallocate(pointer, DEFAULT_HEADER_SIZE);
+}
+
+void operator delete[](void *pointer, std::size_t) noexcept {
+    deallocate(pointer, DEFAULT_HEADER_SIZE);
+}
+
+void operator delete(void *pointer, std::align_val_t alignment) noexcept {
+    deallocate(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void *pointer, std::align_val_t alignment) noexcept {
+    deallocate(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void *pointer, std::size_t, std::align_val_t alignment) noexcept {
+    deallocate(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void *pointer, std::size_t, std::align_val_t alignment) noexcept {
+    deallocate(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void *pointer, const std::nothrow_t &) noexcept {
+    deallocate(pointer, DEFAULT_HEADER_SIZE);
+}
+
+void operator delete[](void *pointer, const std::nothrow_t &) noexcept {
+    deallocate(pointer, DEFAULT_HEADER_SIZE);
+}
+
+void operator delete(void *pointer, std::align_val_t alignment, const std::nothrow_t &) noexcept {
+    deallocate(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void *pointer, std::align_val_t alignment, const std::nothrow_t &) noexcept {
+    deallocate(pointer, static_cast<std::size_t>(alignment));
+}
+
+#endif
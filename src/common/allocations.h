@@ -0,0 +1,61 @@
+
+#ifndef AOC_2023_ALLOCATIONS_H
+#define AOC_2023_ALLOCATIONS_H
+
+#include <cstdint>
+#include <ostream>
+
+/**
+ * Allocation accounting. When the build is configured with AOC_TRACK_ALLOCATIONS, the global
+ * operator new/delete are replaced by counting versions (see allocations.cpp). Otherwise all
+ * counters stay at zero and nothing is reported.
+ */
+namespace allocations {
+
+    struct Stats {
+        uint64_t allocations{};
+        uint64_t deallocations{};
+        uint64_t bytes{};
+        uint64_t liveBytes{};
+        uint64_t peakLiveBytes{};
+    };
+
+    constexpr bool isTrackingEnabled() {
+#ifdef AOC_TRACK_ALLOCATIONS
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * Current process-wide counters.
+     */
+    Stats snapshot();
+
+    /**
+     * Counts the allocations made since construction or the last reset().
+     * The peak is measured relative to the bytes that were live when the phase started,
+     * so phases should not be nested.
+     */
+    class Phase {
+    public:
+        Phase();
+
+        void reset();
+
+        [[nodiscard]] Stats stats() const;
+
+    private:
+        Stats m_begin;
+    };
+
+    /**
+     * Appends ", N allocations (B bytes, peak P bytes live)" when tracking is enabled, nothing otherwise.
+     * Meant to be streamed right after the elapsed time of a phase.
+     */
+    std::ostream &operator<<(std::ostream &out, const Phase &phase);
+
+}
+
+#endif
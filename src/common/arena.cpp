@@ -0,0 +1,57 @@
+
+#include "arena.h"
+
+#include <memory>
+
+namespace {
+
+    // Covers the scratch of most stages, larger ones continue in blocks from the default resource.
+    constexpr size_t THREAD_BLOCK_SIZE = 256 * 1024;
+
+    thread_local std::pmr::memory_resource *currentResource = nullptr;
+    thread_local bool threadBlockInUse = false;
+
+    std::byte *threadBlock() {
+        thread_local std::unique_ptr<std::byte[]> block{new std::byte[THREAD_BLOCK_SIZE]};
+        return block.get();
+    }
+
+    std::pmr::monotonic_buffer_resource makeResource(bool ownsThreadBlock) {
+        if (ownsThreadBlock) {
+            return std::pmr::monotonic_buffer_resource(threadBlock(), THREAD_BLOCK_SIZE,
+                                                       std::pmr::get_default_resource());
+        }
+        return std::pmr::monotonic_buffer_resource(THREAD_BLOCK_SIZE, std::pmr::get_default_resource());
+    }
+
+}
+
+namespace arena {
+
+    std::pmr::memory_resource *current() {
+        return currentResource != nullptr ? currentResource : std::pmr::get_default_resource();
+    }
+
+    Scope::Scope() : m_ownsThreadBlock(!threadBlockInUse),
+                     m_resource(makeResource(m_ownsThreadBlock)),
+                     m_previous(currentResource) {
+        threadBlockInUse = true;
+        currentResource = &m_resource;
+    }
+
+    Scope::~Scope() {
+        currentResource = m_previous;
+        if (m_ownsThreadBlock) {
+            threadBlockInUse = false;
+        }
+    }
+
+    Suspend::Suspend() : m_previous(currentResource) {
+        currentResource = nullptr;
+    }
+
+    Suspend::~Suspend() {
+        currentResource = m_previous;
+    }
+
+}
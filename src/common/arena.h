@@ -0,0 +1,65 @@
+
+#ifndef AOC_2023_ARENA_H
+#define AOC_2023_ARENA_H
+
+#include <cstddef>
+#include <memory_resource>
+
+/**
+ * Scratch memory of a solver stage. Every stage (parse, part 1, part 2) runs in a Scope holding a
+ * monotonic std::pmr arena, so short-lived containers allocated from current() are bump-allocated
+ * on the solving thread and released in bulk when the stage ends, without touching the
+ * general-purpose allocator that parallel batch runs contend on.
+ *
+ * The arena belongs to the thread that opened the scope and is not thread-safe. Containers
+ * allocated from it must not outlive the stage, e.g. the parsed input must not use it.
+ */
+namespace arena {
+
+    /**
+     * The arena of the innermost scope on this thread, the default resource outside of scopes.
+     */
+    std::pmr::memory_resource *current();
+
+    class Scope {
+    public:
+        Scope();
+
+        ~Scope();
+
+        Scope(const Scope &) = delete;
+
+        Scope &operator=(const Scope &) = delete;
+
+        std::pmr::memory_resource *resource() {
+            return &m_resource;
+        }
+
+    private:
+        // The outermost scope of a thread starts in a block the thread keeps for its next scopes.
+        bool m_ownsThreadBlock;
+        std::pmr::monotonic_buffer_resource m_resource;
+        std::pmr::memory_resource *m_previous;
+    };
+
+    /**
+     * Makes current() the default resource while alive. Parallel loop bodies run suspended (see
+     * scheduler.h), as a worker may run them for a stage of another thread.
+     */
+    class Suspend {
+    public:
+        Suspend();
+
+        ~Suspend();
+
+        Suspend(const Suspend &) = delete;
+
+        Suspend &operator=(const Suspend &) = delete;
+
+    private:
+        std::pmr::memory_resource *m_previous;
+    };
+
+}
+
+#endif
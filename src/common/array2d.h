@@ -5,22 +5,30 @@
 #include <vector>
 #include <iostream>
 #include <functional>
+#include <memory>
+#include <memory_resource>
 #include <utility>
 #include "Coord.h"
+#include "huge_pages.h"
 
-template<typename T>
+/**
+ * The allocator is that of the underlying vector, see PmrArray2D for grids in a scratch arena.
+ */
+template<typename T, typename Allocator = std::allocator<T>>
 class Array2D {
 private:
-    std::vector<T> m_data;
+    std::vector<T, Allocator> m_data;
     std::size_t m_rows;
     std::size_t m_cols;
 
 public:
+    using allocator_type = Allocator;
+
     Array2D() : Array2D(0, 0) {
     }
 
-    Array2D(std::size_t rows, std::size_t cols)
-            : m_rows(rows), m_cols(cols) {
+    Array2D(std::size_t rows, std::size_t cols, const Allocator &allocator = Allocator())
+            : m_data(allocator), m_rows(rows), m_cols(cols) {
         m_data.resize(rows * cols);
     }
 
@@ -47,6 +55,13 @@ public:
         return m_data[index];
     }
 
+    const T &operator[](std::size_t index) const {
+        if (index >= m_data.size()) {
+            throw std::out_of_range("Array2D: Index out of bounds");
+        }
+        return m_data[index];
+    }
+
     T &operator()(std::size_t row, std::size_t col) {
         if (row >= m_rows || col >= m_cols) {
             throw std::out_of_range("Array2D: Index out of bounds");
@@ -67,30 +82,34 @@ public:
 
     std::size_t size() const { return m_data.size(); }
 
+    const T *data() const { return m_data.data(); }
+
     void resize(std::size_t rows, std::size_t cols) {
         m_rows = rows;
         m_cols = cols;
         m_data.resize(rows * cols);
     }
 
-    typename std::vector<T>::iterator begin() {
+    allocator_type get_allocator() const { return m_data.get_allocator(); }
+
+    typename std::vector<T, Allocator>::iterator begin() {
         return m_data.begin();
     }
 
-    typename std::vector<T>::iterator end() {
+    typename std::vector<T, Allocator>::iterator end() {
         return m_data.end();
     }
 
-    typename std::vector<T>::const_iterator cbegin() const {
+    typename std::vector<T, Allocator>::const_iterator cbegin() const {
         return m_data.cbegin();
     }
 
-    typename std::vector<T>::const_iterator cend() const {
+    typename std::vector<T, Allocator>::const_iterator cend() const {
         return m_data.cend();
     }
 
-    Array2D<T> transpose() const {
-        Array2D<T> transposed(m_cols, m_rows);
+    Array2D transpose() const {
+        Array2D transposed(m_cols, m_rows, m_data.get_allocator());
         for (std::size_t row = 0; row < m_rows; ++row) {
             for (std::size_t col = 0; col < m_cols; ++col) {
                 transposed(col, row) = (*this)(row, col);
@@ -329,4 +348,16 @@ public:
     }
 };
 
+/**
+ * A grid allocated from a memory resource, e.g. the stage's scratch arena (see arena.h).
+ */
+template<typename T>
+using PmrArray2D = Array2D<T, std::pmr::polymorphic_allocator<T>>;
+
+/**
+ * A grid in huge pages when they are enabled, for large maps accessed at random (see huge_pages.h).
+ */
+template<typename T>
+using HugeArray2D = Array2D<T, huge_pages::Allocator<T>>;
+
 #endif
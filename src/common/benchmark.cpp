@@ -0,0 +1,217 @@
+
+#include "benchmark.h"
+
+#include "json.h"
+#include "output_silencer.h"
+#include "solver.h"
+#include "timer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+
+namespace {
+
+    std::vector<bench::Benchmark> &registry() {
+        static std::vector<bench::Benchmark> benchmarks{};
+        return benchmarks;
+    }
+
+    double median(std::vector<double> &values) {
+        auto middle = values.begin() + static_cast<std::ptrdiff_t>(values.size() / 2);
+        std::nth_element(values.begin(), middle, values.end());
+        double upper = *middle;
+        if (values.size() % 2 == 1) {
+            return upper;
+        }
+        double lower = *std::max_element(values.begin(), middle);
+        return (lower + upper) / 2.0;
+    }
+
+    bool isSelected(const bench::Benchmark &benchmark, const bench::Options &options) {
+        if (benchmark.name.find(options.filter) == std::string::npos) {
+            return false;
+        }
+        return !benchmark.disabled || options.includeDisabled;
+    }
+
+}
+
+namespace bench {
+
+    Stats computeStats(std::vector<double> samples) {
+        if (samples.empty()) {
+            return Stats{};
+        }
+        Stats stats{};
+        stats.samples = samples.size();
+        stats.min = *std::min_element(samples.begin(), samples.end());
+        stats.median = median(samples);
+
+        std::vector<double> deviations(samples.size());
+        std::transform(samples.begin(), samples.end(), deviations.begin(), [&stats](double sample) {
+            return std::abs(sample - stats.median);
+        });
+        stats.mad = median(deviations);
+        return stats;
+    }
+
+    void add(Benchmark benchmark) {
+        registry().push_back(std::move(benchmark));
+    }
+
+    std::vector<Benchmark> benchmarks() {
+        auto sorted = registry();
+        std::stable_sort(sorted.begin(), sorted.end(), [](const Benchmark &a, const Benchmark &b) {
+            return a.day < b.day;
+        });
+        return sorted;
+    }
+
+    std::vector<Result> runAll(const Options &options) {
+        std::vector<Result> results{};
+
+        for (const auto &benchmark: benchmarks()) {
+            if (!isSelected(benchmark, options)) {
+                continue;
+            }
+            std::cerr << "Running " << benchmark.name << "..." << std::endl;
+
+            std::vector<double> samples{};
+            samples.reserve(options.repetitions);
+            std::string error{};
+            {
+                OutputSilencer silencer{};
+                try {
+                    for (int i = 0; i < options.warmup + options.repetitions; i++) {
+                        benchmark.prepare(options);
+
+                        Timer timer;
+                        benchmark.run(options);
+                        double elapsed = timer.elapsed();
+
+                        if (i >= options.warmup) {
+                            samples.push_back(elapsed);
+                        }
+                    }
+                } catch (const std::exception &exception) {
+                    error = exception.what();
+                }
+                benchmark.teardown();
+            }
+
+            results.push_back(Result{
+                    .name = benchmark.name, .day = benchmark.day, .phase = benchmark.phase,
+                    .stats = computeStats(samples), .error = error});
+        }
+        return results;
+    }
+
+    void printTable(std::ostream &out, const std::vector<Result> &results) {
+        constexpr double milliseconds = 1e3;
+
+        out << std::left << std::setw(16) << "benchmark" << std::right
+            << std::setw(14) << "median [ms]" << std::setw(14) << "MAD [ms]" << std::setw(14) << "min [ms]"
+            << std::setw(8) << "reps" << "\n";
+        out << std::fixed << std::setprecision(4);
+        for (const auto &result: results) {
+            if (!result.error.empty()) {
+                out << std::left << std::setw(16) << result.name << "failed: " << result.error << "\n";
+                continue;
+            }
+            out << std::left << std::setw(16) << result.name << std::right
+                << std::setw(14) << result.stats.median * milliseconds
+                << std::setw(14) << result.stats.mad * milliseconds
+                << std::setw(14) << result.stats.min * milliseconds
+                << std::setw(8) << result.stats.samples << "\n";
+        }
+        out << std::defaultfloat;
+    }
+
+    void writeJson(std::ostream &out, const Options &options, const std::vector<Result> &results) {
+        constexpr double nanoseconds = 1e9;
+
+        out << "{\n";
+        out << "  \"warmup\": " << options.warmup << ",\n";
+        out << "  \"repetitions\": " << options.repetitions << ",\n";
+        out << "  \"benchmarks\": [";
+        for (size_t i = 0; i < results.size(); i++) {
+            const auto &result = results[i];
+            out << (i == 0 ? "\n" : ",\n");
+            out << "    {\"name\": \"" << json::escape(result.name) << "\", \"day\": " << result.day
+                << ", \"phase\": \"" << json::escape(result.phase) << "\""
+                << std::fixed << std::setprecision(0)
+                << ", \"median_ns\": " << result.stats.median * nanoseconds
+                << ", \"mad_ns\": " << result.stats.mad * nanoseconds
+                << ", \"min_ns\": " << result.stats.min * nanoseconds
+                << std::defaultfloat
+                << ", \"samples\": " << result.stats.samples;
+            if (!result.error.empty()) {
+                out << ", \"error\": \"" << json::escape(result.error) << "\"";
+            }
+            out << "}";
+        }
+        out << "\n  ]\n}\n";
+    }
+
+    std::string dayName(int day) {
+        return solver::dayName(day);
+    }
+
+    void registerSolvers() {
+        for (const auto &day: solver::days()) {
+            // The parsed input is shared by the parts and released once a benchmark is done with it.
+            auto parsed = std::make_shared<solver::ParsedInput>();
+            auto parse = [day, parsed](const Options &options) {
+                if (options.embedded && !day.embeddedInput.empty()) {
+                    *parsed = day.parse(day.embeddedInput);
+                    return;
+                }
+                auto text = solver::readInput(options.inputDirectory + "/" + solver::inputFileName(day.day));
+                *parsed = day.parse(text);
+            };
+            auto parseOnce = [parse, parsed](const Options &options) {
+                if (!*parsed) {
+                    parse(options);
+                }
+            };
+            auto teardown = [parsed]() {
+                parsed->reset();
+            };
+
+            add(Benchmark{
+                    .name = dayName(day.day) + " load",
+                    .day = day.day,
+                    .phase = "load",
+                    .prepare = [parsed](const Options &) {
+                        parsed->reset();
+                    },
+                    .run = parse,
+                    .teardown = teardown});
+            add(Benchmark{
+                    .name = dayName(day.day) + " part1",
+                    .day = day.day,
+                    .phase = "part1",
+                    .prepare = parseOnce,
+                    .run = [part1 = day.part1, parsed](const Options &) {
+                        part1(*parsed);
+                    },
+                    .teardown = teardown});
+            add(Benchmark{
+                    .name = dayName(day.day) + " part2",
+                    .day = day.day,
+                    .phase = "part2",
+                    .disabled = day.options.slowPart2,
+                    .prepare = parseOnce,
+                    .run = [part2 = day.part2, parsed](const Options &) {
+                        part2(*parsed);
+                    },
+                    .teardown = teardown});
+        }
+    }
+
+}
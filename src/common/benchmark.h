@@ -0,0 +1,85 @@
+
+#ifndef AOC_2023_BENCHMARK_H
+#define AOC_2023_BENCHMARK_H
+
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * Benchmark harness behind the aoc_bench target. Every registered solver contributes its input
+ * loading and both parts; the harness repeats each of them with warm-up and reports robust statistics.
+ */
+namespace bench {
+
+    struct Options {
+        int warmup = 1;
+        int repetitions = 10;
+        // Only benchmarks whose name contains the filter are run, e.g. "day05" or "part2".
+        std::string filter{};
+        std::string inputDirectory{"."};
+        // Loads parse the days' embedded inputs (see solver::Day::embeddedInput) instead of reading files.
+        bool embedded = false;
+        bool includeDisabled = false;
+    };
+
+    /**
+     * Times are in seconds. MAD is the median absolute deviation from the median.
+     */
+    struct Stats {
+        double median{};
+        double mad{};
+        double min{};
+        std::size_t samples{};
+    };
+
+    Stats computeStats(std::vector<double> samples);
+
+    struct Benchmark {
+        std::string name;
+        int day{};
+        std::string phase;
+        // Disabled benchmarks (e.g. solvers that do not finish on the puzzle input) only run on request.
+        bool disabled = false;
+        // Called before every repetition, not timed.
+        std::function<void(const Options &)> prepare;
+        // The timed region.
+        std::function<void(const Options &)> run;
+        // Called once all repetitions are done, to release inputs.
+        std::function<void()> teardown;
+    };
+
+    struct Result {
+        std::string name;
+        int day{};
+        std::string phase;
+        Stats stats;
+        // Set when the benchmark threw, e.g. because the solver is unfinished.
+        std::string error{};
+    };
+
+    void add(Benchmark benchmark);
+
+    /**
+     * Registered benchmarks ordered by day: load, part1, part2.
+     */
+    std::vector<Benchmark> benchmarks();
+
+    std::vector<Result> runAll(const Options &options);
+
+    void printTable(std::ostream &out, const std::vector<Result> &results);
+
+    void writeJson(std::ostream &out, const Options &options, const std::vector<Result> &results);
+
+    std::string dayName(int day);
+
+    /**
+     * Registers "dayNN load" (reading and parsing the input), "dayNN part1" and "dayNN part2"
+     * of every solver linked into the binary. Part 2 of days marked slow is disabled.
+     */
+    void registerSolvers();
+
+}
+
+#endif
@@ -0,0 +1,115 @@
+
+#include "cache.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <thread>
+
+#include <unistd.h>
+
+#include "hash.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+    std::string toHex(uint64_t value) {
+        char buffer[17];
+        std::snprintf(buffer, sizeof(buffer), "%016llx", static_cast<unsigned long long>(value));
+        return buffer;
+    }
+
+    std::string entryName(const cache::Key &key) {
+        return toHex(key.inputHash) + "." + std::to_string(key.part);
+    }
+
+    /**
+     * Entries of other builds of the day can never be hit again.
+     */
+    void removeOtherBuilds(const fs::path &buildDirectory) {
+        std::error_code error{};
+        for (const auto &entry: fs::directory_iterator(buildDirectory.parent_path(), error)) {
+            if (entry.path() != buildDirectory) {
+                fs::remove_all(entry.path(), error);
+            }
+        }
+    }
+
+}
+
+namespace cache {
+
+    Key makeKey(const solver::Day &day, int part, std::string_view input) {
+        return {.day = day.day, .part = part, .buildId = day.buildId, .inputHash = hash::xxh64(input)};
+    }
+
+    std::optional<Store> Store::open() {
+        auto environment = [](const char *name) {
+            const char *value = std::getenv(name);
+            return std::string(value != nullptr ? value : "");
+        };
+
+        if (environment("AOC_CACHE") == "off") {
+            return std::nullopt;
+        }
+        if (auto directory = environment("AOC_CACHE_DIR"); !directory.empty()) {
+            return Store(directory);
+        }
+        if (auto directory = environment("XDG_CACHE_HOME"); !directory.empty()) {
+            return Store(fs::path(directory) / "aoc-2024");
+        }
+        if (auto directory = environment("HOME"); !directory.empty()) {
+            return Store(fs::path(directory) / ".cache" / "aoc-2024");
+        }
+        return std::nullopt;
+    }
+
+    fs::path Store::buildDirectory(const Key &key) const {
+        return m_directory / solver::dayName(key.day) / key.buildId;
+    }
+
+    std::optional<solver::Answer> Store::find(const Key &key) const {
+        if (key.buildId.empty()) {
+            return std::nullopt;
+        }
+        std::ifstream file(buildDirectory(key) / entryName(key), std::ios::binary);
+        if (!file) {
+            return std::nullopt;
+        }
+        return solver::Answer(std::string(std::istreambuf_iterator<char>(file), {}));
+    }
+
+    void Store::save(const Key &key, const solver::Answer &answer) const {
+        if (key.buildId.empty()) {
+            return;
+        }
+        auto directory = buildDirectory(key);
+        std::error_code error{};
+        if (fs::create_directories(directory, error)) {
+            removeOtherBuilds(directory);
+        }
+        if (error) {
+            return;
+        }
+
+        // Written aside and renamed, so that concurrent readers never see a partial answer.
+        std::ostringstream temporaryName{};
+        temporaryName << entryName(key) << ".tmp." << getpid() << "." << std::this_thread::get_id();
+        auto temporary = directory / temporaryName.str();
+        {
+            std::ofstream file(temporary, std::ios::binary);
+            if (!(file << answer.value)) {
+                fs::remove(temporary, error);
+                return;
+            }
+        }
+        fs::rename(temporary, directory / entryName(key), error);
+        if (error) {
+            fs::remove(temporary, error);
+        }
+    }
+
+}
@@ -0,0 +1,57 @@
+
+#ifndef AOC_2023_CACHE_H
+#define AOC_2023_CACHE_H
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+
+#include "solver.h"
+
+/**
+ * On-disk store of answers shared by all harnesses, keyed by (day, part, solver build id, hash of
+ * the input bytes). Entries live in <directory>/dayNN/<build id>/<input hash>.<part>, so that a
+ * changed solver misses the entries of its previous builds; those are removed when the new build
+ * stores its first answer.
+ */
+namespace cache {
+
+    struct Key {
+        int day{};
+        int part{};
+        // Answers of solvers without a build id are never cached.
+        std::string buildId;
+        uint64_t inputHash{};
+    };
+
+    Key makeKey(const solver::Day &day, int part, std::string_view input);
+
+    class Store {
+    public:
+        explicit Store(std::filesystem::path directory) : m_directory(std::move(directory)) {
+        }
+
+        /**
+         * The store in $AOC_CACHE_DIR, $XDG_CACHE_HOME/aoc-2024 or ~/.cache/aoc-2024.
+         * Empty when caching is turned off with AOC_CACHE=off. The day executables use it only with
+         * AOC_CACHE=on (see solver::runDay()).
+         */
+        static std::optional<Store> open();
+
+        std::optional<solver::Answer> find(const Key &key) const;
+
+        /**
+         * Best effort, a store that cannot be written to behaves as an empty one.
+         */
+        void save(const Key &key, const solver::Answer &answer) const;
+
+    private:
+        std::filesystem::path m_directory;
+
+        std::filesystem::path buildDirectory(const Key &key) const;
+    };
+
+}
+
+#endif
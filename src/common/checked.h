@@ -0,0 +1,125 @@
+
+#ifndef AOC_2023_CHECKED_H
+#define AOC_2023_CHECKED_H
+
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+/**
+ * Overflow-aware arithmetic for answers. Operations throw std::overflow_error instead of wrapping,
+ * and Accumulator sums in a machine word until it would overflow and only then carries into 128
+ * bits, so that sums of puzzle-sized inputs stay on the fast path and scaled-up ones stay correct.
+ */
+namespace checked {
+
+    using Wide = __int128;
+
+    template<typename T>
+    concept Integer = std::integral<T> || std::same_as<T, Wide>;
+
+    template<Integer T>
+    T add(T a, T b) {
+        T result;
+        if (__builtin_add_overflow(a, b, &result)) {
+            throw std::overflow_error("checked: Sum overflows");
+        }
+        return result;
+    }
+
+    template<Integer T>
+    T mul(T a, T b) {
+        T result;
+        if (__builtin_mul_overflow(a, b, &result)) {
+            throw std::overflow_error("checked: Product overflows");
+        }
+        return result;
+    }
+
+    /**
+     * The value as a To, throws std::overflow_error when it does not fit.
+     */
+    template<Integer To, Integer From>
+    To narrow(From value) {
+        To result;
+        if (__builtin_add_overflow(value, From{0}, &result)) {
+            throw std::overflow_error("checked: Value does not fit");
+        }
+        return result;
+    }
+
+    inline std::string toString(Wide value) {
+        if (value == 0) {
+            return "0";
+        }
+        // Digits of the magnitude, which is representable unsigned even for the most negative value.
+        auto magnitude = value < 0 ? -static_cast<unsigned __int128>(value) : static_cast<unsigned __int128>(value);
+        std::string digits{};
+        for (; magnitude != 0; magnitude /= 10) {
+            digits.push_back(static_cast<char>('0' + static_cast<int>(magnitude % 10)));
+        }
+        if (value < 0) {
+            digits.push_back('-');
+        }
+        std::reverse(digits.begin(), digits.end());
+        return digits;
+    }
+
+    /**
+     * Sums 64-bit values and products exactly. The running sum stays in an int64_t, and when an
+     * addition would overflow it, the sum so far moves into a 128-bit carry.
+     */
+    class Accumulator {
+    public:
+        void add(int64_t value) {
+            if (__builtin_add_overflow(m_narrow, value, &m_narrow)) {
+                // The wrapped sum is off by 2^64 in the direction of the value.
+                m_carry += value < 0 ? -(Wide{1} << 64) : (Wide{1} << 64);
+            }
+        }
+
+        void addWide(Wide value) {
+            m_carry += value;
+        }
+
+        void addProduct(int64_t a, int64_t b) {
+            int64_t product;
+            if (__builtin_mul_overflow(a, b, &product)) {
+                addWide(static_cast<Wide>(a) * b);
+            } else {
+                add(product);
+            }
+        }
+
+        Accumulator &operator+=(const Accumulator &other) {
+            add(other.m_narrow);
+            m_carry += other.m_carry;
+            return *this;
+        }
+
+        friend Accumulator operator+(Accumulator lhs, const Accumulator &rhs) {
+            lhs += rhs;
+            return lhs;
+        }
+
+        [[nodiscard]] Wide total() const {
+            return m_carry + m_narrow;
+        }
+
+        /**
+         * Whether the sum left the fast path.
+         */
+        [[nodiscard]] bool widened() const {
+            return m_carry != 0;
+        }
+
+    private:
+        int64_t m_narrow = 0;
+        Wide m_carry = 0;
+    };
+
+}
+
+#endif
@@ -0,0 +1,167 @@
+
+#ifndef AOC_2023_CYCLE_TIMER_H
+#define AOC_2023_CYCLE_TIMER_H
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#define AOC_HAS_TSC 1
+#endif
+
+/**
+ * Time-stamp counter reads for timing short regions, e.g. a single instruction dispatch.
+ * On targets without a TSC, and on hosts whose TSC does not count at a constant rate or that lack
+ * rdtscp, the "cycles" are steady_clock nanoseconds.
+ */
+namespace cycles {
+
+    /**
+     * Whether the host has rdtscp (CPUID 0x80000001, EDX bit 27) and an invariant TSC, which ticks
+     * at the same rate in every power state (CPUID 0x80000007, EDX bit 8). Checked once.
+     */
+    inline bool hasUsableTsc() {
+#ifdef AOC_HAS_TSC
+        static const bool usable = []() {
+            constexpr unsigned RDTSCP_BIT = 1u << 27;
+            constexpr unsigned INVARIANT_TSC_BIT = 1u << 8;
+            unsigned eax, ebx, ecx, edx;
+            if (!__get_cpuid(0x80000001, &eax, &ebx, &ecx, &edx) || !(edx & RDTSCP_BIT)) {
+                return false;
+            }
+            return __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) && (edx & INVARIANT_TSC_BIT);
+        }();
+        return usable;
+#else
+        return false;
+#endif
+    }
+
+    inline uint64_t readClock() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    /**
+     * Reads the counter at the beginning of a region. The fences keep earlier instructions from
+     * being counted and later ones from starting before the read.
+     */
+    inline uint64_t readStart() {
+#ifdef AOC_HAS_TSC
+        if (hasUsableTsc()) {
+            _mm_lfence();
+            uint64_t value = __rdtsc();
+            _mm_lfence();
+            return value;
+        }
+#endif
+        return readClock();
+    }
+
+    /**
+     * Reads the counter at the end of a region. rdtscp waits for the region to retire.
+     */
+    inline uint64_t readStop() {
+#ifdef AOC_HAS_TSC
+        if (hasUsableTsc()) {
+            unsigned int processorId;
+            uint64_t value = __rdtscp(&processorId);
+            _mm_lfence();
+            return value;
+        }
+#endif
+        return readClock();
+    }
+
+    /**
+     * Measures the counter against steady_clock (about 10 ms of busy waiting).
+     */
+    inline double calibrate() {
+        if (!hasUsableTsc()) {
+            return 1.0;
+        }
+        using Clock = std::chrono::steady_clock;
+        constexpr auto calibrationTime = std::chrono::milliseconds(10);
+
+        auto clockBegin = Clock::now();
+        auto cyclesBegin = readStart();
+        auto clockEnd = clockBegin;
+        while (clockEnd - clockBegin < calibrationTime) {
+            clockEnd = Clock::now();
+        }
+        auto cyclesEnd = readStop();
+
+        auto nanoseconds = std::chrono::duration<double, std::nano>(clockEnd - clockBegin).count();
+        return nanoseconds / static_cast<double>(cyclesEnd - cyclesBegin);
+    }
+
+    /**
+     * Calibrated on first use, so that programs that never convert cycles do not wait for it.
+     * Harnesses that may convert cycles within a timed part calibrate ahead of it, see
+     * profiling::calibrateCounter().
+     */
+    inline double nanosecondsPerCycle() {
+        static const double calibrated = calibrate();
+        return calibrated;
+    }
+
+    inline double toNanoseconds(uint64_t cycleCount) {
+        return static_cast<double>(cycleCount) * nanosecondsPerCycle();
+    }
+
+    /**
+     * Reporting mode for kernels: prints "X cycles/item (Y ns/item, N items)".
+     */
+    struct PerItem {
+        uint64_t cycleCount;
+        uint64_t items;
+
+        [[nodiscard]] double cyclesPerItem() const {
+            return items == 0 ? 0.0 : static_cast<double>(cycleCount) / static_cast<double>(items);
+        }
+
+        friend std::ostream &operator<<(std::ostream &out, const PerItem &perItem) {
+            out << perItem.cyclesPerItem() << " cycles/item ("
+                << perItem.cyclesPerItem() * nanosecondsPerCycle() << " ns/item, " << perItem.items << " items)";
+            return out;
+        }
+    };
+
+}
+
+/**
+ * Counterpart of Timer backed by the time-stamp counter.
+ */
+class CycleTimer {
+private:
+    uint64_t m_beg{cycles::readStart()};
+
+public:
+    void reset() {
+        m_beg = cycles::readStart();
+    }
+
+    [[nodiscard]] uint64_t elapsedCycles() const {
+        return cycles::readStop() - m_beg;
+    }
+
+    [[nodiscard]] double elapsedNanoseconds() const {
+        return cycles::toNanoseconds(elapsedCycles());
+    }
+
+    /**
+     * Seconds, so that CycleTimer can stand in for Timer.
+     */
+    [[nodiscard]] double elapsed() const {
+        return elapsedNanoseconds() * 1e-9;
+    }
+
+    [[nodiscard]] cycles::PerItem perItem(uint64_t items) const {
+        return cycles::PerItem{.cycleCount = elapsedCycles(), .items = items};
+    }
+};
+
+#endif
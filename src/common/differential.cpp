@@ -0,0 +1,103 @@
+#include "differential.h"
+
+#include <algorithm>
+#include <exception>
+
+namespace {
+
+    std::vector<differential::Check> &registry() {
+        static std::vector<differential::Check> checks{};
+        return checks;
+    }
+
+    bool disagrees(const differential::Check &check, std::string_view input) {
+        try {
+            return differential::compare(check, input).has_value();
+        } catch (const std::exception &) {
+            return false;
+        }
+    }
+
+    std::string join(const std::vector<std::string_view> &pieces) {
+        std::string text{};
+        for (auto piece: pieces) {
+            text += piece;
+        }
+        return text;
+    }
+
+    /**
+     * Removes chunks of pieces, halving the chunk size whenever no chunk can be removed.
+     */
+    std::string removePieces(const differential::Check &check, std::vector<std::string_view> pieces) {
+        for (auto chunk = pieces.size() / 2; chunk > 0; chunk /= 2) {
+            bool removed = true;
+            while (removed) {
+                removed = false;
+                for (size_t start = 0; start + chunk <= pieces.size();) {
+                    std::vector<std::string_view> candidate(pieces.begin(), pieces.begin() + static_cast<std::ptrdiff_t>(start));
+                    candidate.insert(candidate.end(), pieces.begin() + static_cast<std::ptrdiff_t>(start + chunk), pieces.end());
+                    if (disagrees(check, join(candidate))) {
+                        pieces = std::move(candidate);
+                        removed = true;
+                    } else {
+                        start += chunk;
+                    }
+                }
+            }
+        }
+        return join(pieces);
+    }
+
+}
+
+namespace differential {
+
+    bool add(Check check) {
+        registry().push_back(std::move(check));
+        return true;
+    }
+
+    std::vector<Check> checks() {
+        auto sorted = registry();
+        std::sort(sorted.begin(), sorted.end(), [](const Check &a, const Check &b) {
+            return a.day != b.day ? a.day < b.day : a.part < b.part;
+        });
+        return sorted;
+    }
+
+    std::optional<Mismatch> compare(const Check &check, std::string_view input) {
+        auto reference = check.reference(input);
+        auto optimized = check.optimized(input);
+        if (reference == optimized) {
+            return std::nullopt;
+        }
+        return Mismatch{.reference = std::move(reference), .optimized = std::move(optimized)};
+    }
+
+    std::string shrink(const Check &check, std::string input) {
+        // Removing characters can leave lines that are now removable as a whole, so the passes repeat
+        // until neither shrinks the input.
+        while (true) {
+            // The pieces view the text they were split from, which must outlive them.
+            std::vector<std::string_view> lines{};
+            for (size_t start = 0; start < input.size();) {
+                auto end = std::min(input.find('\n', start), input.size() - 1) + 1;
+                lines.push_back(std::string_view(input).substr(start, end - start));
+                start = end;
+            }
+            auto shrunk = removePieces(check, lines);
+
+            std::vector<std::string_view> characters{};
+            for (size_t i = 0; i < shrunk.size(); i++) {
+                characters.push_back(std::string_view(shrunk).substr(i, 1));
+            }
+            shrunk = removePieces(check, characters);
+            if (shrunk.size() == input.size()) {
+                return shrunk;
+            }
+            input = std::move(shrunk);
+        }
+    }
+
+}
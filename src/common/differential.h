@@ -0,0 +1,85 @@
+
+#ifndef AOC_2023_DIFFERENTIAL_H
+#define AOC_2023_DIFFERENTIAL_H
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "arena.h"
+#include "solver.h"
+
+/**
+ * Differential checks of optimized solvers. When a day replaces a straightforward implementation
+ * with a faster one, it keeps the former as a reference and registers both, and the tests feed
+ * them generated inputs and compare the answers (see tests/common/differential_tests.cpp).
+ * A failing input is shrunk to a small reproducer.
+ */
+namespace differential {
+
+    /**
+     * Answers a part of a day from the input text.
+     */
+    using Implementation = std::function<solver::Answer(std::string_view text)>;
+
+    struct Check {
+        int day{};
+        int part{};
+        // What the optimized implementation replaces, e.g. "reorderUpdate".
+        std::string name;
+        Implementation reference;
+        Implementation optimized;
+    };
+
+    /**
+     * Returns true so that it can initialize a namespace-scope constant in the day's library.
+     */
+    bool add(Check check);
+
+    /**
+     * Registered checks ordered by day and part.
+     */
+    std::vector<Check> checks();
+
+    struct Mismatch {
+        solver::Answer reference;
+        solver::Answer optimized;
+    };
+
+    /**
+     * The answers of both implementations when they differ. Exceptions of either propagate.
+     */
+    std::optional<Mismatch> compare(const Check &check, std::string_view input);
+
+    /**
+     * Shrinks an input the implementations disagree on, by removing lines and then characters for
+     * as long as they still disagree. Candidates either implementation throws on are skipped, so
+     * the implementations must terminate on any input they do not reject. A day's parse should
+     * therefore throw on inputs that break the puzzle's promises (see day05's parseInput()).
+     */
+    std::string shrink(const Check &check, std::string input);
+
+    /**
+     * Registers two implementations of a part taking the input parsed by the solver.
+     */
+    template<solver::Solver S, typename Reference, typename Optimized>
+    bool registerCheck(int day, int part, std::string name, Reference reference, Optimized optimized) {
+        auto wrap = [](auto implementation) -> Implementation {
+            return [implementation](std::string_view text) {
+                arena::Scope scratch{};
+                return solver::Answer(implementation(S::parse(text)));
+            };
+        };
+        return add(Check{
+                .day = day,
+                .part = part,
+                .name = std::move(name),
+                .reference = wrap(reference),
+                .optimized = wrap(optimized),
+        });
+    }
+
+}
+
+#endif
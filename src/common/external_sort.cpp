@@ -0,0 +1,101 @@
+#include "external_sort.h"
+
+#include <cerrno>
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <unistd.h>
+
+#include "logging.h"
+
+namespace {
+
+    std::string directory() {
+        const char *directory = std::getenv("AOC_SORT_DIR");
+        return directory != nullptr ? std::string(directory) : std::filesystem::temp_directory_path().string();
+    }
+
+    std::runtime_error systemError(const std::string &message) {
+        return std::runtime_error(message + ": " + std::strerror(errno));
+    }
+
+}
+
+namespace external_sort {
+
+    size_t parseSize(std::string_view text) {
+        size_t value = 0;
+        auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (error != std::errc{} || value == 0) {
+            throw std::invalid_argument("external_sort: Invalid size " + std::string(text));
+        }
+        auto suffix = text.substr(static_cast<size_t>(end - text.data()));
+        int shift = 0;
+        if (suffix == "K") {
+            shift = 10;
+        } else if (suffix == "M") {
+            shift = 20;
+        } else if (suffix == "G") {
+            shift = 30;
+        } else if (!suffix.empty()) {
+            throw std::invalid_argument("external_sort: Invalid size " + std::string(text));
+        }
+        if (value > (SIZE_MAX >> shift)) {
+            throw std::invalid_argument("external_sort: Invalid size " + std::string(text));
+        }
+        return value << shift;
+    }
+
+    std::optional<size_t> budgetFromEnvironment() {
+        const char *budget = std::getenv("AOC_SORT_BUDGET");
+        if (budget == nullptr) {
+            return std::nullopt;
+        }
+        try {
+            return parseSize(budget);
+        } catch (const std::invalid_argument &) {
+            AOC_LOG_WARNING("Invalid AOC_SORT_BUDGET=" << budget << ", sorting in memory");
+            return std::nullopt;
+        }
+    }
+
+    TempFile TempFile::create() {
+        auto path = (std::filesystem::path(directory()) / "aoc-sort-XXXXXX").string();
+        int descriptor = ::mkstemp(path.data());
+        if (descriptor < 0) {
+            throw systemError("Cannot create sort run in " + directory());
+        }
+        // Unlinked right away, so that the run is removed however the process ends.
+        ::unlink(path.c_str());
+        std::FILE *file = ::fdopen(descriptor, "w+b");
+        if (file == nullptr) {
+            ::close(descriptor);
+            throw systemError("Cannot open sort run");
+        }
+        return TempFile(file);
+    }
+
+    void TempFile::write(const void *data, size_t bytes) {
+        if (bytes != 0 && std::fwrite(data, 1, bytes, m_file.get()) != bytes) {
+            throw systemError("Cannot write sort run");
+        }
+    }
+
+    size_t TempFile::read(void *data, size_t bytes) {
+        auto count = std::fread(data, 1, bytes, m_file.get());
+        if (count != bytes && std::ferror(m_file.get())) {
+            throw systemError("Cannot read sort run");
+        }
+        return count;
+    }
+
+    void TempFile::rewind() {
+        if (std::fflush(m_file.get()) != 0 || std::fseek(m_file.get(), 0, SEEK_SET) != 0) {
+            throw systemError("Cannot rewind sort run");
+        }
+    }
+
+}
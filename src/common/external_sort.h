@@ -0,0 +1,319 @@
+
+#ifndef AOC_2023_EXTERNAL_SORT_H
+#define AOC_2023_EXTERNAL_SORT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Sorting of inputs larger than memory. A Sorter collects values in a buffer of the memory budget,
+ * sorts every full buffer into a run on disk and merges the runs back as a sorted stream, so that
+ * the values are never all in memory at once.
+ *
+ * AOC_SORT_BUDGET in the environment, e.g. "512M", asks the days that support it to sort on disk
+ * within that many bytes. The runs go to AOC_SORT_DIR, or to the system's temporary directory.
+ */
+namespace external_sort {
+
+    /**
+     * Reads of a run in a merge are at least this large, so that merging many runs stays sequential
+     * I/O. The runs that one pass can merge are limited accordingly.
+     */
+    constexpr size_t BLOCK_BYTES = 64 * 1024;
+
+    /**
+     * Bytes with an optional K, M or G suffix of powers of 1024, e.g. "64M". Throws
+     * std::invalid_argument for other text and for zero.
+     */
+    size_t parseSize(std::string_view text);
+
+    /**
+     * AOC_SORT_BUDGET, or none when it is unset or malformed.
+     */
+    std::optional<size_t> budgetFromEnvironment();
+
+    /**
+     * An unnamed file in AOC_SORT_DIR or the temporary directory, removed when closed.
+     */
+    class TempFile {
+    public:
+        /**
+         * Throws std::runtime_error when the file cannot be created.
+         */
+        static TempFile create();
+
+        void write(const void *data, size_t bytes);
+
+        /**
+         * Bytes read, fewer than asked only at the end of the file.
+         */
+        size_t read(void *data, size_t bytes);
+
+        void rewind();
+
+    private:
+        explicit TempFile(std::FILE *file) : m_file(file, &std::fclose) {
+        }
+
+        std::unique_ptr<std::FILE, decltype(&std::fclose)> m_file;
+    };
+
+    /**
+     * One pass over sorted runs, merged through a heap of their heads.
+     */
+    template<typename T>
+    class Merger {
+        static_assert(std::is_trivially_copyable_v<T>, "Runs are written as raw bytes");
+
+    public:
+        /**
+         * Reads the runs from their start, in buffers that share the budget. Every run gets at least
+         * one element.
+         */
+        Merger(std::span<TempFile *const> runs, size_t budgetBytes) {
+            auto bufferSize = std::max<size_t>(1, budgetBytes / std::max<size_t>(1, runs.size()) / sizeof(T));
+            m_sources.reserve(runs.size());
+            for (auto *run: runs) {
+                run->rewind();
+                m_sources.push_back(Source{.file = run, .buffer = std::vector<T>(bufferSize), .values = {},
+                                           .position = 0});
+            }
+            start();
+        }
+
+        /**
+         * Sorted values that fit in memory.
+         */
+        explicit Merger(std::span<const T> sorted) {
+            m_sources.push_back(Source{.file = nullptr, .buffer = {}, .values = sorted, .position = 0});
+            start();
+        }
+
+        bool next(T &value) {
+            if (m_heap.empty()) {
+                return false;
+            }
+            std::pop_heap(m_heap.begin(), m_heap.end(), Greater{});
+            auto index = m_heap.back().second;
+            value = m_heap.back().first;
+            m_heap.pop_back();
+            if (m_sources[index].advance()) {
+                m_heap.emplace_back(m_sources[index].head(), index);
+                std::push_heap(m_heap.begin(), m_heap.end(), Greater{});
+            }
+            return true;
+        }
+
+    private:
+        struct Source {
+            TempFile *file;
+            std::vector<T> buffer{};
+            std::span<const T> values{};
+            size_t position = 0;
+
+            [[nodiscard]] const T &head() const {
+                return values[position];
+            }
+
+            /**
+             * Moves to the next value, false when the run is exhausted.
+             */
+            bool advance() {
+                if (++position < values.size()) {
+                    return true;
+                }
+                return refill();
+            }
+
+            bool refill() {
+                if (file == nullptr) {
+                    return false;
+                }
+                auto bytes = file->read(buffer.data(), buffer.size() * sizeof(T));
+                values = std::span<const T>(buffer.data(), bytes / sizeof(T));
+                position = 0;
+                return !values.empty();
+            }
+        };
+
+        struct Greater {
+            bool operator()(const std::pair<T, size_t> &a, const std::pair<T, size_t> &b) const {
+                return b.first < a.first;
+            }
+        };
+
+        void start() {
+            for (size_t i = 0; i < m_sources.size(); i++) {
+                auto &source = m_sources[i];
+                if (!source.values.empty() || source.refill()) {
+                    m_heap.emplace_back(source.head(), i);
+                }
+            }
+            std::make_heap(m_heap.begin(), m_heap.end(), Greater{});
+        }
+
+        std::vector<Source> m_sources;
+        std::vector<std::pair<T, size_t>> m_heap{};
+    };
+
+    /**
+     * Sorts any number of values within a memory budget. Push the values, finish(), and then
+     * read them with as many passes of sorted() as needed, one at a time.
+     *
+     * Runs are merged while the values come in, whenever a pass's fan-in of runs of one size is on
+     * disk. So fewer than fan-in runs of each size stay open, and the sizes grow by the fan-in.
+     */
+    template<typename T>
+    class Sorter {
+        static_assert(std::is_trivially_copyable_v<T>, "Runs are written as raw bytes");
+
+    public:
+        /**
+         * Throws std::invalid_argument when the budget cannot hold two values.
+         */
+        explicit Sorter(size_t budgetBytes)
+                : m_budget(budgetBytes),
+                  // A merged run is written through a block of the budget, the inputs share the rest.
+                  m_outputSize(std::max<size_t>(1, std::min(BLOCK_BYTES, budgetBytes / 2) / sizeof(T))),
+                  m_inputBudget(budgetBytes - std::min(budgetBytes, m_outputSize * sizeof(T))),
+                  m_fanIn(std::max<size_t>(2, m_inputBudget / BLOCK_BYTES)) {
+            if (budgetBytes < 2 * sizeof(T)) {
+                throw std::invalid_argument("external_sort: Budget below two values");
+            }
+            m_buffer.reserve(budgetBytes / sizeof(T));
+        }
+
+        void push(const T &value) {
+            if (m_buffer.size() == m_buffer.capacity()) {
+                spill();
+            }
+            m_buffer.push_back(value);
+            m_size++;
+        }
+
+        /**
+         * Writes out the last run, if any went to disk, and merges runs until the rest can be merged
+         * in one pass.
+         */
+        void finish() {
+            if (m_runs.empty()) {
+                std::sort(m_buffer.begin(), m_buffer.end());
+                return;
+            }
+            if (!m_buffer.empty()) {
+                spill();
+            }
+            std::vector<T>().swap(m_buffer);
+            while (m_runs.size() > m_fanIn) {
+                mergeYoungest();
+            }
+        }
+
+        /**
+         * A pass over the values in ascending order. Passes must not overlap.
+         */
+        Merger<T> sorted() {
+            if (m_runs.empty()) {
+                return Merger<T>(std::span<const T>(m_buffer));
+            }
+            std::vector<TempFile *> runs{};
+            for (auto &run: m_runs) {
+                runs.push_back(&run.file);
+            }
+            return Merger<T>(runs, m_budget);
+        }
+
+        [[nodiscard]] size_t size() const {
+            return m_size;
+        }
+
+        /**
+         * Runs on disk, none when the values fit the budget.
+         */
+        [[nodiscard]] size_t runCount() const {
+            return m_runs.size();
+        }
+
+    private:
+        struct Run {
+            TempFile file;
+            // Merges the values went through, runs of a level are about fan-in times the size of the
+            // level below.
+            int level;
+        };
+
+        void spill() {
+            std::sort(m_buffer.begin(), m_buffer.end());
+            auto file = TempFile::create();
+            file.write(m_buffer.data(), m_buffer.size() * sizeof(T));
+            m_runs.push_back(Run{.file = std::move(file), .level = 0});
+            m_buffer.clear();
+
+            // The levels only decrease towards the youngest runs, so a full level is at the end.
+            if (hasFullLevel()) {
+                // The sort buffer makes way for the buffers of the merge.
+                auto capacity = m_buffer.capacity();
+                std::vector<T>().swap(m_buffer);
+                while (hasFullLevel()) {
+                    mergeYoungest();
+                }
+                m_buffer.reserve(capacity);
+            }
+        }
+
+        [[nodiscard]] bool hasFullLevel() const {
+            return m_runs.size() >= m_fanIn && m_runs[m_runs.size() - m_fanIn].level == m_runs.back().level;
+        }
+
+        /**
+         * Replaces the youngest, and smallest, fan-in runs with their merge.
+         */
+        void mergeYoungest() {
+            auto first = m_runs.size() - m_fanIn;
+            std::vector<TempFile *> inputs{};
+            int level = 0;
+            for (size_t i = first; i < m_runs.size(); i++) {
+                inputs.push_back(&m_runs[i].file);
+                level = std::max(level, m_runs[i].level);
+            }
+            auto merged = TempFile::create();
+            {
+                Merger<T> merger(inputs, m_inputBudget);
+                std::vector<T> output{};
+                output.reserve(m_outputSize);
+                T value;
+                while (merger.next(value)) {
+                    output.push_back(value);
+                    if (output.size() == m_outputSize) {
+                        merged.write(output.data(), output.size() * sizeof(T));
+                        output.clear();
+                    }
+                }
+                merged.write(output.data(), output.size() * sizeof(T));
+            }
+            m_runs.erase(m_runs.begin() + static_cast<std::ptrdiff_t>(first), m_runs.end());
+            m_runs.push_back(Run{.file = std::move(merged), .level = level + 1});
+        }
+
+        size_t m_budget;
+        size_t m_outputSize;
+        size_t m_inputBudget;
+        size_t m_fanIn;
+        size_t m_size = 0;
+        std::vector<T> m_buffer{};
+        std::vector<Run> m_runs{};
+    };
+
+}
+
+#endif
@@ -0,0 +1,379 @@
+
+#ifndef AOC_2023_GRID_SEARCH_H
+#define AOC_2023_GRID_SEARCH_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <memory_resource>
+#include <span>
+#include <stdexcept>
+#include <vector>
+#include "Coord.h"
+#include "arena.h"
+
+/**
+ * Shortest paths over states numbered 0..stateCount-1, such as the cells of a grid or the cells
+ * times the facing of a walker (see GridStates). Distances and predecessors are dense arrays
+ * indexed by state instead of hash maps, and a search object keeps its arrays between runs and
+ * only resets the states the previous run touched, so searching again from another source does
+ * not allocate.
+ *
+ * The graph is given by a callable neighbors(state, emit) that calls emit(next) for BFS and
+ * emit(next, weight) for Dijkstra for every edge leaving the state. Searches allocate from
+ * arena::current() by default and must not outlive the stage then.
+ */
+namespace grid_search {
+
+    using State = uint32_t;
+    using Distance = uint32_t;
+
+    constexpr Distance UNREACHED = std::numeric_limits<Distance>::max();
+    constexpr State NO_STATE = std::numeric_limits<State>::max();
+
+    /**
+     * Numbers the states (coord, layer) of a grid, layer being e.g. the direction a walker faces.
+     * The layers of one cell are adjacent.
+     */
+    class GridStates {
+    public:
+        GridStates(std::size_t rows, std::size_t cols, std::size_t layers = 1)
+                : m_rows(rows), m_cols(cols), m_layers(layers) {
+            if (rows * cols * layers >= NO_STATE) {
+                throw std::invalid_argument("GridStates: Too many states");
+            }
+        }
+
+        [[nodiscard]] std::size_t count() const noexcept { return m_rows * m_cols * m_layers; }
+
+        [[nodiscard]] bool contains(Coord coord) const noexcept {
+            return coord.row >= 0 && coord.col >= 0 && static_cast<std::size_t>(coord.row) < m_rows &&
+                   static_cast<std::size_t>(coord.col) < m_cols;
+        }
+
+        [[nodiscard]] State encode(Coord coord, std::size_t layer = 0) const noexcept {
+            return static_cast<State>((static_cast<std::size_t>(coord.row) * m_cols +
+                                       static_cast<std::size_t>(coord.col)) * m_layers + layer);
+        }
+
+        [[nodiscard]] Coord coord(State state) const noexcept {
+            auto cell = state / m_layers;
+            return Coord{.col = static_cast<int>(cell % m_cols), .row = static_cast<int>(cell / m_cols)};
+        }
+
+        [[nodiscard]] std::size_t layer(State state) const noexcept { return state % m_layers; }
+
+    private:
+        std::size_t m_rows;
+        std::size_t m_cols;
+        std::size_t m_layers;
+    };
+
+    /**
+     * Dial's priority queue for integer keys that never exceed the last popped key by more than
+     * maxWeight: a ring of maxWeight + 1 buckets, each holding the states of one key.
+     */
+    class BucketQueue {
+    public:
+        BucketQueue(Distance maxWeight, std::pmr::memory_resource *resource)
+                : m_buckets(static_cast<std::size_t>(maxWeight) + 1, resource) {
+        }
+
+        [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+
+        /**
+         * The key must be in [minKey(), minKey() + maxWeight].
+         */
+        void push(State state, Distance key) {
+            m_buckets[key % m_buckets.size()].push_back(state);
+            m_size++;
+        }
+
+        /**
+         * The smallest key in the queue, which must not be empty.
+         */
+        Distance minKey() {
+            while (m_buckets[m_current % m_buckets.size()].empty()) {
+                m_current++;
+            }
+            return m_current;
+        }
+
+        State pop() {
+            auto &bucket = m_buckets[minKey() % m_buckets.size()];
+            auto state = bucket.back();
+            bucket.pop_back();
+            m_size--;
+            return state;
+        }
+
+        void clear() {
+            for (auto &bucket: m_buckets) {
+                bucket.clear();
+            }
+            m_current = 0;
+            m_size = 0;
+        }
+
+    private:
+        std::pmr::vector<std::pmr::vector<State>> m_buckets;
+        Distance m_current = 0;
+        std::size_t m_size = 0;
+    };
+
+    /**
+     * Distances, predecessors and the list of states a run reached, shared by the searches.
+     */
+    class SearchState {
+    public:
+        SearchState(std::size_t stateCount, std::pmr::memory_resource *resource)
+                : m_distance(stateCount, UNREACHED, resource), m_predecessor(stateCount, NO_STATE, resource),
+                  m_touched(resource) {
+        }
+
+        [[nodiscard]] std::size_t stateCount() const noexcept { return m_distance.size(); }
+
+        [[nodiscard]] Distance distance(State state) const { return m_distance[state]; }
+
+        [[nodiscard]] bool reached(State state) const { return m_distance[state] != UNREACHED; }
+
+        /**
+         * The state the shortest path to this one came from, NO_STATE for sources and unreached states.
+         */
+        [[nodiscard]] State predecessor(State state) const { return m_predecessor[state]; }
+
+        /**
+         * The states the last run reached. A BFS lists them by distance.
+         */
+        [[nodiscard]] std::span<const State> reachedStates() const noexcept { return m_touched; }
+
+        /**
+         * The states from a source to the target, empty when the target was not reached.
+         */
+        [[nodiscard]] std::vector<State> path(State target) const {
+            std::vector<State> states{};
+            if (!reached(target)) {
+                return states;
+            }
+            for (auto state = target; state != NO_STATE; state = m_predecessor[state]) {
+                states.push_back(state);
+            }
+            std::reverse(states.begin(), states.end());
+            return states;
+        }
+
+    protected:
+        void reset() {
+            for (auto state: m_touched) {
+                m_distance[state] = UNREACHED;
+                m_predecessor[state] = NO_STATE;
+            }
+            m_touched.clear();
+        }
+
+        bool improve(State state, Distance distance, State predecessor) {
+            if (distance >= m_distance[state]) {
+                return false;
+            }
+            if (m_distance[state] == UNREACHED) {
+                m_touched.push_back(state);
+            }
+            m_distance[state] = distance;
+            m_predecessor[state] = predecessor;
+            return true;
+        }
+
+        std::pmr::vector<Distance> m_distance;
+        std::pmr::vector<State> m_predecessor;
+        std::pmr::vector<State> m_touched;
+    };
+
+    /**
+     * Breadth-first search. Every state enters the queue once, so the list of reached states is
+     * the queue itself.
+     */
+    class Bfs : public SearchState {
+    public:
+        explicit Bfs(std::size_t stateCount, std::pmr::memory_resource *resource = arena::current())
+                : SearchState(stateCount, resource) {
+            m_touched.reserve(stateCount);
+        }
+
+        /**
+         * Searches from the sources until every reachable state is visited or isTarget(state) holds
+         * for a visited state, which is returned. Returns NO_STATE when no target is reached.
+         */
+        template<typename Neighbors, typename IsTarget>
+        State run(std::span<const State> sources, Neighbors &&neighbors, IsTarget &&isTarget) {
+            reset();
+            for (auto source: sources) {
+                improve(source, 0, NO_STATE);
+            }
+            for (std::size_t head = 0; head < m_touched.size(); head++) {
+                auto state = m_touched[head];
+                if (isTarget(state)) {
+                    return state;
+                }
+                auto next = m_distance[state] + 1;
+                neighbors(state, [&](State neighbor) {
+                    improve(neighbor, next, state);
+                });
+            }
+            return NO_STATE;
+        }
+
+        template<typename Neighbors>
+        void run(std::span<const State> sources, Neighbors &&neighbors) {
+            run(sources, neighbors, [](State) { return false; });
+        }
+
+        template<typename... Callbacks>
+        auto run(std::initializer_list<State> sources, Callbacks &&...callbacks) {
+            return run(std::span<const State>(sources.begin(), sources.size()), callbacks...);
+        }
+    };
+
+    /**
+     * Dijkstra's search with integer edge weights in [0, maxWeight] over a BucketQueue, which
+     * pushes and pops in constant time. maxWeight 1 makes it a 0-1 BFS.
+     */
+    class Dijkstra : public SearchState {
+    public:
+        Dijkstra(std::size_t stateCount, Distance maxWeight, std::pmr::memory_resource *resource = arena::current())
+                : SearchState(stateCount, resource), m_maxWeight(maxWeight), m_queue(maxWeight, resource) {
+        }
+
+        [[nodiscard]] Distance maxWeight() const noexcept { return m_maxWeight; }
+
+        /**
+         * Searches from the sources until every reachable state is settled or isTarget(state) holds
+         * for a settled state, which is returned. Returns NO_STATE when no target is reached.
+         */
+        template<typename Neighbors, typename IsTarget>
+        State run(std::span<const State> sources, Neighbors &&neighbors, IsTarget &&isTarget) {
+            start(sources);
+            while (!m_queue.empty()) {
+                auto state = settleNext(neighbors, [](State, Distance) {});
+                if (state != NO_STATE && isTarget(state)) {
+                    return state;
+                }
+            }
+            return NO_STATE;
+        }
+
+        template<typename Neighbors>
+        void run(std::span<const State> sources, Neighbors &&neighbors) {
+            run(sources, neighbors, [](State) { return false; });
+        }
+
+        template<typename... Callbacks>
+        auto run(std::initializer_list<State> sources, Callbacks &&...callbacks) {
+            return run(std::span<const State>(sources.begin(), sources.size()), callbacks...);
+        }
+
+        /**
+         * Resets the search and queues the sources; settleNext() then advances it by one state.
+         */
+        void start(std::span<const State> sources) {
+            reset();
+            m_queue.clear();
+            for (auto source: sources) {
+                if (improve(source, 0, NO_STATE)) {
+                    m_queue.push(source, 0);
+                }
+            }
+        }
+
+        [[nodiscard]] bool done() const noexcept { return m_queue.empty(); }
+
+        /**
+         * A lower bound of the distance of the next state to settle. The search must not be done.
+         */
+        Distance frontier() { return m_queue.minKey(); }
+
+        /**
+         * Settles the state with the smallest distance and relaxes its edges, calling
+         * onEdge(next, distance through the edge) for each. Returns NO_STATE when the popped entry
+         * was outdated.
+         */
+        template<typename Neighbors, typename OnEdge>
+        State settleNext(Neighbors &&neighbors, OnEdge &&onEdge) {
+            auto key = m_queue.minKey();
+            auto state = m_queue.pop();
+            if (m_distance[state] < key) {
+                return NO_STATE;
+            }
+            neighbors(state, [&](State neighbor, Distance weight) {
+                if (weight > m_maxWeight) {
+                    throw std::out_of_range("Dijkstra: Edge weight above the maximum");
+                }
+                auto distance = key + weight;
+                onEdge(neighbor, distance);
+                if (improve(neighbor, distance, state)) {
+                    m_queue.push(neighbor, distance);
+                }
+            });
+            return state;
+        }
+
+    private:
+        Distance m_maxWeight;
+        BucketQueue m_queue;
+    };
+
+    /**
+     * The length of a shortest path from the sources of forward to the targets, searching from
+     * both ends until the frontiers meet. backwardNeighbors must list the reversed edges, with the
+     * same weights. Both searches must have the same maxWeight; use maxWeight 1 and weights of 1
+     * for unweighted graphs. Returns UNREACHED when no target is reachable.
+     *
+     * When meeting is given it receives a state on a shortest path, from which the path can be
+     * assembled from forward.path(meeting) and the backward predecessors.
+     */
+    template<typename ForwardNeighbors, typename BackwardNeighbors>
+    Distance bidirectional(Dijkstra &forward, Dijkstra &backward,
+                           std::span<const State> sources, std::span<const State> targets,
+                           ForwardNeighbors &&forwardNeighbors, BackwardNeighbors &&backwardNeighbors,
+                           State *meeting = nullptr) {
+        if (forward.stateCount() != backward.stateCount() || forward.maxWeight() != backward.maxWeight()) {
+            throw std::invalid_argument("bidirectional: The searches do not match");
+        }
+        forward.start(sources);
+        backward.start(targets);
+
+        Distance best = UNREACHED;
+        State bestState = NO_STATE;
+        auto meet = [&](const Dijkstra &other, State state, Distance distance) {
+            if (other.reached(state) && distance + other.distance(state) < best) {
+                best = distance + other.distance(state);
+                bestState = state;
+            }
+        };
+        for (auto source: sources) {
+            meet(backward, source, 0);
+        }
+
+        // Any path not found yet is at least as long as the sum of the two frontiers.
+        while (!forward.done() && !backward.done() &&
+               (best == UNREACHED || forward.frontier() + backward.frontier() < best)) {
+            if (forward.frontier() <= backward.frontier()) {
+                forward.settleNext(forwardNeighbors, [&](State next, Distance distance) {
+                    meet(backward, next, distance);
+                });
+            } else {
+                backward.settleNext(backwardNeighbors, [&](State next, Distance distance) {
+                    meet(forward, next, distance);
+                });
+            }
+        }
+        if (meeting != nullptr) {
+            *meeting = bestState;
+        }
+        return best;
+    }
+
+}
+
+#endif
@@ -0,0 +1,98 @@
+
+#ifndef AOC_2023_HASH_H
+#define AOC_2023_HASH_H
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+/**
+ * Fast non-cryptographic hashing of input bytes, cheaper than parsing them.
+ */
+namespace hash {
+
+    namespace detail {
+
+        constexpr uint64_t PRIME1 = 0x9E3779B185EBCA87ULL;
+        constexpr uint64_t PRIME2 = 0xC2B2AE3D27D4EB4FULL;
+        constexpr uint64_t PRIME3 = 0x165667B19E3779F9ULL;
+        constexpr uint64_t PRIME4 = 0x85EBCA77C2B2AE63ULL;
+        constexpr uint64_t PRIME5 = 0x27D4EB2F165667C5ULL;
+
+        inline uint64_t read64(const char *data) {
+            uint64_t value;
+            std::memcpy(&value, data, sizeof(value));
+            return value;
+        }
+
+        inline uint32_t read32(const char *data) {
+            uint32_t value;
+            std::memcpy(&value, data, sizeof(value));
+            return value;
+        }
+
+        inline uint64_t round(uint64_t accumulator, uint64_t lane) {
+            accumulator += lane * PRIME2;
+            return std::rotl(accumulator, 31) * PRIME1;
+        }
+
+        inline uint64_t merge(uint64_t accumulator, uint64_t lane) {
+            accumulator ^= round(0, lane);
+            return accumulator * PRIME1 + PRIME4;
+        }
+
+    }
+
+    /**
+     * XXH64 of the bytes, equal to the reference implementation on little-endian machines.
+     */
+    inline uint64_t xxh64(std::string_view bytes, uint64_t seed = 0) {
+        using namespace detail;
+
+        const char *data = bytes.data();
+        const char *end = data + bytes.size();
+        uint64_t result;
+
+        if (bytes.size() >= 32) {
+            uint64_t lanes[4] = {seed + PRIME1 + PRIME2, seed + PRIME2, seed, seed - PRIME1};
+            for (; end - data >= 32; data += 32) {
+                for (int i = 0; i < 4; i++) {
+                    lanes[i] = round(lanes[i], read64(data + 8 * i));
+                }
+            }
+            result = std::rotl(lanes[0], 1) + std::rotl(lanes[1], 7) + std::rotl(lanes[2], 12) +
+                     std::rotl(lanes[3], 18);
+            for (auto lane: lanes) {
+                result = merge(result, lane);
+            }
+        } else {
+            result = seed + PRIME5;
+        }
+        result += bytes.size();
+
+        for (; end - data >= 8; data += 8) {
+            result ^= round(0, read64(data));
+            result = std::rotl(result, 27) * PRIME1 + PRIME4;
+        }
+        if (end - data >= 4) {
+            result ^= read32(data) * PRIME1;
+            result = std::rotl(result, 23) * PRIME2 + PRIME3;
+            data += 4;
+        }
+        for (; data < end; data++) {
+            result ^= static_cast<uint8_t>(*data) * PRIME5;
+            result = std::rotl(result, 11) * PRIME1;
+        }
+
+        result ^= result >> 33;
+        result *= PRIME2;
+        result ^= result >> 29;
+        result *= PRIME3;
+        result ^= result >> 32;
+        return result;
+    }
+
+}
+
+#endif
@@ -0,0 +1,201 @@
+
+#include "huge_pages.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_set>
+#include <sys/mman.h>
+
+#include "logging.h"
+
+namespace {
+
+    std::atomic<huge_pages::Mode> &currentMode() {
+        static std::atomic<huge_pages::Mode> mode = []() {
+            const char *name = std::getenv("AOC_HUGE_PAGES");
+            try {
+                return name != nullptr ? huge_pages::parseMode(name) : huge_pages::Mode::Off;
+            } catch (const std::invalid_argument &) {
+                AOC_LOG_WARNING("Unknown AOC_HUGE_PAGES=" << name << ", huge pages are off");
+                return huge_pages::Mode::Off;
+            }
+        }();
+        return mode;
+    }
+
+    std::atomic<size_t> regularBytes{0};
+    std::atomic<size_t> transparentBytes{0};
+    std::atomic<size_t> hugeTlbBytes{0};
+
+    /**
+     * Blocks that were mapped rather than taken from operator new, only large ones are ever here.
+     */
+    struct Mappings {
+        std::mutex mutex;
+        std::unordered_set<void *> blocks;
+    };
+
+    Mappings &mappings() {
+        static Mappings instance{};
+        return instance;
+    }
+
+    void *remember(void *pointer) {
+        auto &registry = mappings();
+        std::lock_guard lock(registry.mutex);
+        registry.blocks.insert(pointer);
+        return pointer;
+    }
+
+    bool forget(void *pointer) {
+        auto &registry = mappings();
+        std::lock_guard lock(registry.mutex);
+        return registry.blocks.erase(pointer) > 0;
+    }
+
+    size_t roundUp(size_t bytes) {
+        return (bytes + huge_pages::HUGE_PAGE_SIZE - 1) / huge_pages::HUGE_PAGE_SIZE * huge_pages::HUGE_PAGE_SIZE;
+    }
+
+    void record(huge_pages::Backing backing, size_t bytes) {
+        switch (backing) {
+            case huge_pages::Backing::Regular:
+                regularBytes += bytes;
+                break;
+            case huge_pages::Backing::Transparent:
+                transparentBytes += bytes;
+                break;
+            case huge_pages::Backing::HugeTlb:
+                hugeTlbBytes += bytes;
+                break;
+        }
+        AOC_LOG_INFO("Huge pages: " << bytes / 1024 << " KiB backed by " << huge_pages::name(backing));
+    }
+
+    void *mapAnonymous(size_t length, int flags) {
+        void *pointer = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | flags, -1, 0);
+        return pointer == MAP_FAILED ? nullptr : pointer;
+    }
+
+    /**
+     * A mapping of whole huge pages, aligned to one so that the kernel can back all of it.
+     */
+    void *mapAligned(size_t length) {
+        void *pointer = mapAnonymous(length + huge_pages::HUGE_PAGE_SIZE, 0);
+        if (pointer == nullptr) {
+            return nullptr;
+        }
+        auto address = reinterpret_cast<uintptr_t>(pointer);
+        auto aligned = roundUp(address);
+        auto head = aligned - address;
+        if (head > 0) {
+            munmap(pointer, head);
+        }
+        munmap(reinterpret_cast<void *>(aligned + length), huge_pages::HUGE_PAGE_SIZE - head);
+        return reinterpret_cast<void *>(aligned);
+    }
+
+}
+
+namespace huge_pages {
+
+    std::string name(Backing backing) {
+        switch (backing) {
+            case Backing::Regular:
+                return "regular pages";
+            case Backing::Transparent:
+                return "transparent huge pages";
+            case Backing::HugeTlb:
+                return "hugetlb pages";
+        }
+        return "unknown";
+    }
+
+    Mode parseMode(const std::string &name) {
+        if (name == "off") {
+            return Mode::Off;
+        } else if (name == "thp") {
+            return Mode::Transparent;
+        } else if (name == "hugetlb") {
+            return Mode::HugeTlb;
+        }
+        throw std::invalid_argument("Unknown huge page mode: " + name);
+    }
+
+    Mode mode() {
+        return currentMode().load(std::memory_order_relaxed);
+    }
+
+    void setMode(Mode newMode) {
+        currentMode().store(newMode, std::memory_order_relaxed);
+    }
+
+    Stats stats() {
+        return Stats{.regularBytes = regularBytes, .transparentBytes = transparentBytes,
+                     .hugeTlbBytes = hugeTlbBytes};
+    }
+
+    size_t anonHugePagesBytes() {
+        std::ifstream smaps("/proc/self/smaps_rollup");
+        std::string line{};
+        while (std::getline(smaps, line)) {
+            if (line.starts_with("AnonHugePages:")) {
+                std::istringstream fields(line.substr(line.find(':') + 1));
+                size_t kilobytes = 0;
+                fields >> kilobytes;
+                return kilobytes * 1024;
+            }
+        }
+        return 0;
+    }
+
+    void *allocate(size_t bytes) {
+        auto currentMode = mode();
+        if (currentMode == Mode::Off || bytes < HUGE_PAGE_SIZE) {
+            return ::operator new(bytes);
+        }
+
+        auto length = roundUp(bytes);
+        if (currentMode == Mode::HugeTlb) {
+            if (void *pointer = mapAnonymous(length, MAP_HUGETLB)) {
+                record(Backing::HugeTlb, length);
+                return remember(pointer);
+            }
+        }
+        void *pointer = mapAligned(length);
+        if (pointer == nullptr) {
+            throw std::bad_alloc();
+        }
+        record(madvise(pointer, length, MADV_HUGEPAGE) == 0 ? Backing::Transparent : Backing::Regular, length);
+        return remember(pointer);
+    }
+
+    void deallocate(void *pointer, size_t bytes) noexcept {
+        // The mode may have changed since the block was allocated.
+        if (bytes >= HUGE_PAGE_SIZE && forget(pointer)) {
+            munmap(pointer, roundUp(bytes));
+            return;
+        }
+        ::operator delete(pointer);
+    }
+
+    Backing advise(void *data, size_t bytes) {
+        auto address = reinterpret_cast<uintptr_t>(data);
+        auto begin = roundUp(address);
+        auto end = (address + bytes) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+        if (mode() == Mode::Off || end <= begin) {
+            return Backing::Regular;
+        }
+        auto length = end - begin;
+        auto backing = madvise(reinterpret_cast<void *>(begin), length, MADV_HUGEPAGE) == 0
+                       ? Backing::Transparent : Backing::Regular;
+        record(backing, length);
+        return backing;
+    }
+
+}
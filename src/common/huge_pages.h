@@ -0,0 +1,100 @@
+
+#ifndef AOC_2023_HUGE_PAGES_H
+#define AOC_2023_HUGE_PAGES_H
+
+#include <cstddef>
+#include <new>
+#include <string>
+
+/**
+ * 2 MB page backing for large grids and input buffers, whose random access otherwise misses the
+ * TLB on every other step. Off by default; AOC_HUGE_PAGES=thp asks for transparent huge pages
+ * (madvise(MADV_HUGEPAGE)), AOC_HUGE_PAGES=hugetlb for reserved ones (MAP_HUGETLB, see
+ * /proc/sys/vm/nr_hugepages) and falls back to transparent and then to regular pages.
+ *
+ * Every allocation of at least one huge page logs at info level which backing it obtained and
+ * is counted in stats(), so that runs with and without huge pages can be compared.
+ */
+namespace huge_pages {
+
+    constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    enum class Mode { Off, Transparent, HugeTlb };
+
+    enum class Backing { Regular, Transparent, HugeTlb };
+
+    std::string name(Backing backing);
+
+    /**
+     * "off", "thp" or "hugetlb". Throws std::invalid_argument for other names.
+     */
+    Mode parseMode(const std::string &name);
+
+    Mode mode();
+
+    void setMode(Mode mode);
+
+    struct Stats {
+        size_t regularBytes = 0;
+        size_t transparentBytes = 0;
+        size_t hugeTlbBytes = 0;
+    };
+
+    /**
+     * Bytes of the allocations and advised buffers of at least one huge page by their backing.
+     */
+    Stats stats();
+
+    /**
+     * Anonymous memory of the process the kernel actually backs with transparent huge pages
+     * (AnonHugePages of /proc/self/smaps_rollup), 0 when unknown.
+     */
+    size_t anonHugePagesBytes();
+
+    /**
+     * Memory of at least one huge page is mapped according to the mode, smaller blocks come from
+     * operator new. Throws std::bad_alloc.
+     */
+    void *allocate(size_t bytes);
+
+    void deallocate(void *pointer, size_t bytes) noexcept;
+
+    /**
+     * Asks for transparent huge pages for the whole huge pages within an existing buffer, e.g. a
+     * std::string reserved but not yet written. Does nothing unless the mode is on.
+     */
+    Backing advise(void *data, size_t bytes);
+
+    /**
+     * Allocator of the containers of large grids, see HugeArray2D.
+     */
+    template<typename T>
+    struct Allocator {
+        using value_type = T;
+
+        Allocator() noexcept = default;
+
+        template<typename U>
+        Allocator(const Allocator<U> &) noexcept {
+        }
+
+        T *allocate(size_t count) {
+            if (count > static_cast<size_t>(-1) / sizeof(T)) {
+                throw std::bad_array_new_length();
+            }
+            return static_cast<T *>(huge_pages::allocate(count * sizeof(T)));
+        }
+
+        void deallocate(T *pointer, size_t count) noexcept {
+            huge_pages::deallocate(pointer, count * sizeof(T));
+        }
+
+        template<typename U>
+        bool operator==(const Allocator<U> &) const noexcept {
+            return true;
+        }
+    };
+
+}
+
+#endif
@@ -4,6 +4,64 @@
 
 #include "input.h"
 
+#include "simd.h"
+
+namespace {
+
+    using input::Blanks;
+
+    template<typename Lines>
+    void splitLinesInto(std::string_view text, Lines &lines) {
+        lines.reserve(simd::countByte(text, '\n') + 1);
+        size_t start = 0;
+        while (start < text.size()) {
+            size_t end = simd::findByte(text, '\n', start);
+            if (end == std::string_view::npos) {
+                end = text.size();
+            }
+            lines.emplace_back(text.substr(start, end - start));
+            start = end + 1;
+        }
+    }
+
+    /**
+     * The parts std::getline() finds, i.e. none after a trailing delimiter.
+     */
+    template<typename Parts>
+    void splitInto(std::string_view string, char delimiter, Blanks blanksOption, Parts &parts) {
+        size_t start = 0;
+        while (start < string.size()) {
+            size_t end = std::min(string.find(delimiter, start), string.size());
+            auto part = string.substr(start, end - start);
+            if (blanksOption != Blanks::Remove || !part.empty()) {
+                parts.emplace_back(part);
+            }
+            start = end + 1;
+        }
+    }
+
+    template<typename Parts>
+    void splitInto(std::string_view string, std::string_view delimiter, Blanks blanksOption, Parts &parts) {
+        size_t start = 0;
+        size_t end = string.find(delimiter);
+
+        while (end != std::string_view::npos) {
+            auto part = string.substr(start, end - start);
+            if (blanksOption != Blanks::Remove || !part.empty()) {
+                parts.emplace_back(part);
+            }
+            start = end + delimiter.length();
+            end = string.find(delimiter, start);
+        }
+
+        auto part = string.substr(start);
+        if (blanksOption != Blanks::Remove || !part.empty()) {
+            parts.emplace_back(part);
+        }
+    }
+
+}
+
 namespace input {
     void checkStream(const std::ifstream &inputStream) {
         if (!inputStream.is_open()) {
@@ -39,41 +97,41 @@ namespace input {
         return lines;
     }
 
+    std::vector<std::string> splitLines(std::string_view text) {
+        std::vector<std::string> lines{};
+        splitLinesInto(text, lines);
+        return lines;
+    }
+
+    std::pmr::vector<std::pmr::string> splitLines(std::string_view text, std::pmr::memory_resource *resource) {
+        std::pmr::vector<std::pmr::string> lines{resource};
+        splitLinesInto(text, lines);
+        return lines;
+    }
+
     std::vector<std::string> split(const std::string &string, char delimiter, Blanks blanksOption) {
         std::vector<std::string> parts{};
-        std::istringstream iss(string);
-        std::string part{};
-
-        while (std::getline(iss, part, delimiter)) {
-            if (blanksOption == Blanks::Remove) {
-                if (part.empty()) {
-                    continue; // Skip empty string
-                }
-            }
-            parts.push_back(part);
-        }
+        splitInto(string, delimiter, blanksOption, parts);
         return parts;
     }
 
     std::vector<std::string> split(const std::string &string, const std::string &delimiter, Blanks blanksOption) {
         std::vector<std::string> parts{};
-        size_t start = 0;
-        size_t end = string.find(delimiter);
-
-        while (end != std::string::npos) {
-            std::string part = string.substr(start, end - start);
-            if (blanksOption != Blanks::Remove || !part.empty()) {
-                parts.push_back(part);
-            }
-            start = end + delimiter.length();
-            end = string.find(delimiter, start);
-        }
+        splitInto(string, std::string_view(delimiter), blanksOption, parts);
+        return parts;
+    }
 
-        std::string part = string.substr(start);
-        if (blanksOption != Blanks::Remove || !part.empty()) {
-            parts.push_back(part);
-        }
+    std::pmr::vector<std::pmr::string> split(std::string_view string, char delimiter, Blanks blanksOption,
+                                             std::pmr::memory_resource *resource) {
+        std::pmr::vector<std::pmr::string> parts{resource};
+        splitInto(string, delimiter, blanksOption, parts);
+        return parts;
+    }
 
+    std::pmr::vector<std::pmr::string> split(std::string_view string, std::string_view delimiter,
+                                             Blanks blanksOption, std::pmr::memory_resource *resource) {
+        std::pmr::vector<std::pmr::string> parts{resource};
+        splitInto(string, delimiter, blanksOption, parts);
         return parts;
     }
 
@@ -5,6 +5,7 @@
 #include <fstream>
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <functional>
 #include <algorithm>
@@ -12,6 +13,8 @@
 #include <limits>
 #include <sstream>
 #include <cstdint>
+#include <charconv>
+#include <memory_resource>
 #include <regex>
 #include "array2d.h"
 
@@ -32,6 +35,16 @@ namespace input {
 
     std::vector<std::string> readLines(std::ifstream &inputStream);
 
+    /**
+     * Splits in-memory input into lines the way readLines() reads them from a file.
+     */
+    std::vector<std::string> splitLines(std::string_view text);
+
+    /**
+     * Lines allocated from the resource, e.g. the stage's scratch arena (see arena.h).
+     */
+    std::pmr::vector<std::pmr::string> splitLines(std::string_view text, std::pmr::memory_resource *resource);
+
     template<typename ReturnType>
     ReturnType readFile(const std::string &fileName, std::function<ReturnType(std::ifstream &)> readerFunction) {
         std::ifstream file(fileName);
@@ -42,11 +55,11 @@ namespace input {
         return result;
     }
 
-    template<typename T>
-    Array2D<T> load2D(const std::vector<std::string> &lines, const std::function<T(char)> &transformFunction) {
+    template<typename T, typename Allocator = std::allocator<T>, typename Lines>
+    Array2D<T, Allocator> load2D(const Lines &lines, const std::function<T(char)> &transformFunction) {
         size_t rows = lines.size();
         size_t cols = lines[0].size();
-        Array2D<T> array(rows, cols);
+        Array2D<T, Allocator> array(rows, cols);
 
         for (size_t row = 0; row < rows; row++) {
             for (size_t col = 0; col < cols; col++) {
@@ -68,6 +81,15 @@ namespace input {
 
     std::vector<std::string> split(const std::string &string, const std::string &delimiter, Blanks blanksOption);
 
+    /**
+     * split() with the parts allocated from the resource, e.g. the stage's scratch arena (see arena.h).
+     */
+    std::pmr::vector<std::pmr::string> split(std::string_view string, char delimiter, Blanks blanksOption,
+                                             std::pmr::memory_resource *resource);
+
+    std::pmr::vector<std::pmr::string> split(std::string_view string, std::string_view delimiter,
+                                             Blanks blanksOption, std::pmr::memory_resource *resource);
+
     template<typename T>
     std::vector<T> convertStringsToNumbers(const std::vector<std::string> &strings) {
         std::vector<T> numbers{};
@@ -90,8 +112,90 @@ namespace input {
         return convertStringsToNumbers<T>(splits);
     }
 
+    /**
+     * Appends the integers separated by the delimiter to the container, parsed in place without
+     * a string per number, e.g. straight into a record's SmallVector.
+     */
+    template<typename T, typename Container>
+    requires std::integral<T>
+    void parseInto(std::string_view string, char delimiter, Container &numbers) {
+        size_t start = 0;
+        while (start < string.size()) {
+            size_t end = std::min(string.find(delimiter, start), string.size());
+            auto part = string.substr(start, end - start);
+            if (!part.empty()) {
+                T number{};
+                auto [rest, error] = std::from_chars(part.data(), part.data() + part.size(), number);
+                if (error != std::errc{} || rest != part.data() + part.size()) {
+                    throw std::invalid_argument("Invalid conversion for string: " + std::string(part));
+                }
+                numbers.push_back(number);
+            }
+            start = end + 1;
+        }
+    }
+
+    /**
+     * parseVector() of integers allocated from the resource.
+     */
+    template<typename T>
+    requires std::integral<T>
+    std::pmr::vector<T> parseVector(std::string_view string, char delimiter, std::pmr::memory_resource *resource) {
+        std::pmr::vector<T> numbers{resource};
+        parseInto<T>(string, delimiter, numbers);
+        return numbers;
+    }
+
     std::vector<std::string> parseVector(const std::string &input, const std::string &pattern);
 
+    /**
+     * The integer in the text, which may be surrounded by whitespace. Throws std::invalid_argument.
+     * Usable in constant expressions, e.g. to parse an embedded input (see AOC_EMBED_INPUTS).
+     */
+    constexpr int64_t parseInteger(std::string_view text) {
+        auto isSpace = [](char character) {
+            return character == ' ' || character == '\t' || character == '\r' || character == '\n';
+        };
+        while (!text.empty() && isSpace(text.front())) {
+            text.remove_prefix(1);
+        }
+        while (!text.empty() && isSpace(text.back())) {
+            text.remove_suffix(1);
+        }
+
+        bool negative = !text.empty() && text.front() == '-';
+        if (negative || (!text.empty() && text.front() == '+')) {
+            text.remove_prefix(1);
+        }
+        if (text.empty()) {
+            throw std::invalid_argument("Invalid integer: empty");
+        }
+        int64_t value = 0;
+        for (char digit: text) {
+            if (digit < '0' || digit > '9') {
+                throw std::invalid_argument("Invalid integer: " + std::string(text));
+            }
+            value = value * 10 + (digit - '0');
+        }
+        return negative ? -value : value;
+    }
+
+    /**
+     * Calls function(field) for every non-empty field between the delimiters.
+     * Usable in constant expressions.
+     */
+    template<typename Function>
+    constexpr void forEachField(std::string_view text, char delimiter, Function &&function) {
+        size_t start = 0;
+        while (start < text.size()) {
+            size_t end = std::min(text.find(delimiter, start), text.size());
+            if (end > start) {
+                function(text.substr(start, end - start));
+            }
+            start = end + 1;
+        }
+    }
+
 }
 
 #endif
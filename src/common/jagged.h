@@ -0,0 +1,263 @@
+
+#ifndef AOC_2023_JAGGED_H
+#define AOC_2023_JAGGED_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include "scheduler.h"
+
+/**
+ * Variable-length records in compressed sparse row form: the values of all records in one
+ * contiguous array and the offset of every record in another, so that a scan over all records
+ * streams memory linearly and kernels can consume values() directly.
+ *
+ * Record i is values()[offsets()[i], offsets()[i + 1]).
+ */
+template<typename T>
+class Jagged {
+    static_assert(std::is_trivially_copyable_v<T>, "Jagged holds trivially copyable values only.");
+
+private:
+    std::vector<T> m_values;
+    std::vector<std::size_t> m_offsets{0};
+
+    static constexpr char SNAPSHOT_MAGIC[8] = {'A', 'O', 'C', 'J', 'A', 'G', 'D', '1'};
+
+    template<typename U>
+    static void writeRaw(std::ostream &out, const U *data, std::size_t count) {
+        out.write(reinterpret_cast<const char *>(data), static_cast<std::streamsize>(count * sizeof(U)));
+    }
+
+    template<typename U>
+    static void readRaw(std::istream &in, U *data, std::size_t count) {
+        auto bytes = static_cast<std::streamsize>(count * sizeof(U));
+        if (!in.read(reinterpret_cast<char *>(data), bytes) || in.gcount() != bytes) {
+            throw std::runtime_error("Jagged: Truncated snapshot");
+        }
+    }
+
+    /**
+     * Reads `count` values in bounded chunks, so that a corrupt count fails at the end of the stream
+     * instead of allocating for the count up front.
+     */
+    template<typename U>
+    static std::vector<U> readCounted(std::istream &in, uint64_t count) {
+        constexpr uint64_t chunkSize = std::max<uint64_t>(1, (uint64_t{1} << 20) / sizeof(U));
+        std::vector<U> data{};
+        while (data.size() < count) {
+            auto start = data.size();
+            auto chunk = std::min<uint64_t>(chunkSize, count - start);
+            data.resize(start + chunk);
+            readRaw(in, data.data() + start, chunk);
+        }
+        return data;
+    }
+
+public:
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::span<const T>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = std::span<const T>;
+
+        const_iterator() = default;
+
+        const_iterator(const Jagged *jagged, std::size_t record) : m_jagged(jagged), m_record(record) {
+        }
+
+        std::span<const T> operator*() const { return (*m_jagged)[m_record]; }
+
+        const_iterator &operator++() {
+            ++m_record;
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator tmp = *this;
+            ++m_record;
+            return tmp;
+        }
+
+        friend bool operator==(const const_iterator &a, const const_iterator &b) {
+            return a.m_record == b.m_record;
+        }
+
+    private:
+        const Jagged *m_jagged = nullptr;
+        std::size_t m_record = 0;
+    };
+
+    Jagged() = default;
+
+    /**
+     * Takes the arrays as they are. Throws std::invalid_argument when the offsets do not start at
+     * zero, decrease, or do not end at the number of values.
+     */
+    Jagged(std::vector<T> values, std::vector<std::size_t> offsets)
+            : m_values(std::move(values)), m_offsets(std::move(offsets)) {
+        if (m_offsets.empty() || m_offsets.front() != 0 || m_offsets.back() != m_values.size() ||
+            !std::is_sorted(m_offsets.begin(), m_offsets.end())) {
+            throw std::invalid_argument("Jagged: Offsets do not match the values");
+        }
+    }
+
+    /**
+     * Number of records.
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return m_offsets.size() - 1; }
+
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    [[nodiscard]] std::size_t valueCount() const noexcept { return m_values.size(); }
+
+    std::span<const T> operator[](std::size_t record) const {
+        return {m_values.data() + m_offsets[record], m_offsets[record + 1] - m_offsets[record]};
+    }
+
+    std::span<T> operator[](std::size_t record) {
+        return {m_values.data() + m_offsets[record], m_offsets[record + 1] - m_offsets[record]};
+    }
+
+    std::span<const T> values() const noexcept { return m_values; }
+
+    std::span<const std::size_t> offsets() const noexcept { return m_offsets; }
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+
+    const_iterator end() const { return const_iterator(this, size()); }
+
+    void reserve(std::size_t records, std::size_t values) {
+        m_offsets.reserve(records + 1);
+        m_values.reserve(values);
+    }
+
+    /**
+     * Appends a value to the last record, which is open until closeRecord().
+     */
+    void pushValue(const T &value) {
+        m_values.push_back(value);
+    }
+
+    void closeRecord() {
+        m_offsets.push_back(m_values.size());
+    }
+
+    template<typename Range>
+    void push_back(const Range &record) {
+        m_values.insert(m_values.end(), std::begin(record), std::end(record));
+        closeRecord();
+    }
+
+    void push_back(std::initializer_list<T> record) {
+        push_back<std::initializer_list<T>>(record);
+    }
+
+    friend bool operator==(const Jagged &lhs, const Jagged &rhs) {
+        return lhs.m_offsets == rhs.m_offsets && lhs.m_values == rhs.m_values;
+    }
+
+    /**
+     * Writes the arrays in host byte order after a header with the value size and the counts.
+     */
+    void save(std::ostream &out) const {
+        uint64_t header[3] = {sizeof(T), size(), valueCount()};
+        out.write(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+        writeRaw(out, header, 3);
+        std::vector<uint64_t> offsets(m_offsets.begin(), m_offsets.end());
+        writeRaw(out, offsets.data(), offsets.size());
+        writeRaw(out, m_values.data(), m_values.size());
+        if (!out) {
+            throw std::ios_base::failure("Jagged: Failed to write snapshot");
+        }
+    }
+
+    /**
+     * Reads a snapshot written by save(). Throws std::runtime_error when it is not one of Jagged<T>.
+     */
+    static Jagged load(std::istream &in) {
+        char magic[sizeof(SNAPSHOT_MAGIC)]{};
+        readRaw(in, magic, sizeof(magic));
+        if (std::memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic)) != 0) {
+            throw std::runtime_error("Jagged: Not a snapshot");
+        }
+        uint64_t header[3]{};
+        readRaw(in, header, 3);
+        if (header[0] != sizeof(T)) {
+            throw std::runtime_error("Jagged: Snapshot of another value type");
+        }
+
+        if (header[1] == std::numeric_limits<uint64_t>::max()) {
+            throw std::runtime_error("Jagged: Corrupt record count");
+        }
+
+        auto offsets = readCounted<uint64_t>(in, header[1] + 1);
+        auto values = readCounted<T>(in, header[2]);
+        try {
+            return Jagged(std::move(values), std::vector<std::size_t>(offsets.begin(), offsets.end()));
+        } catch (const std::invalid_argument &) {
+            throw std::runtime_error("Jagged: Corrupt offsets");
+        }
+    }
+};
+
+/**
+ * Builds the records in parallel: record i holds the values fill(i, out) pushes to out, a
+ * std::vector<T>. Chunks of grainSize records are filled into buffers of their own and copied
+ * into place after a prefix sum over the chunk sizes, so records are only parsed once.
+ */
+template<typename T, typename Fill>
+Jagged<T> buildJagged(std::size_t records, Fill &&fill, std::size_t grainSize = 1024) {
+    struct Chunk {
+        std::vector<T> values;
+        std::vector<std::size_t> lengths;
+        std::size_t start = 0;
+    };
+
+    grainSize = std::max<std::size_t>(grainSize, 1);
+    std::vector<Chunk> chunks((records + grainSize - 1) / grainSize);
+    scheduler::parallelFor(std::size_t{0}, chunks.size(), [&](std::size_t chunkIndex) {
+        auto &chunk = chunks[chunkIndex];
+        auto last = std::min(records, (chunkIndex + 1) * grainSize);
+        chunk.lengths.reserve(last - chunkIndex * grainSize);
+        for (auto record = chunkIndex * grainSize; record < last; record++) {
+            auto before = chunk.values.size();
+            fill(record, chunk.values);
+            chunk.lengths.push_back(chunk.values.size() - before);
+        }
+    });
+
+    std::size_t valueCount = 0;
+    for (auto &chunk: chunks) {
+        chunk.start = valueCount;
+        valueCount += chunk.values.size();
+    }
+
+    std::vector<T> values(valueCount);
+    std::vector<std::size_t> offsets(records + 1);
+    offsets[records] = valueCount;
+    scheduler::parallelFor(std::size_t{0}, chunks.size(), [&](std::size_t chunkIndex) {
+        const auto &chunk = chunks[chunkIndex];
+        std::copy(chunk.values.begin(), chunk.values.end(), values.begin() + static_cast<std::ptrdiff_t>(chunk.start));
+        auto offset = chunk.start;
+        auto record = chunkIndex * grainSize;
+        for (auto length: chunk.lengths) {
+            offsets[record++] = offset;
+            offset += length;
+        }
+    });
+    return Jagged<T>(std::move(values), std::move(offsets));
+}
+
+#endif
@@ -0,0 +1,47 @@
+#include "json.h"
+
+#include <cstdio>
+
+namespace json {
+
+    std::string escape(std::string_view text) {
+        std::string escaped{};
+        escaped.reserve(text.size());
+        for (char character: text) {
+            switch (character) {
+                case '"':
+                    escaped += "\\\"";
+                    break;
+                case '\\':
+                    escaped += "\\\\";
+                    break;
+                case '\n':
+                    escaped += "\\n";
+                    break;
+                case '\r':
+                    escaped += "\\r";
+                    break;
+                case '\t':
+                    escaped += "\\t";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(character) < 0x20) {
+                        char code[7];
+                        std::snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned>(character));
+                        escaped += code;
+                    } else {
+                        escaped.push_back(character);
+                    }
+            }
+        }
+        return escaped;
+    }
+
+    std::string quote(std::string_view text) {
+        std::string quoted = "\"";
+        quoted.append(escape(text));
+        quoted.push_back('"');
+        return quoted;
+    }
+
+}
@@ -0,0 +1,26 @@
+
+#ifndef AOC_2023_JSON_H
+#define AOC_2023_JSON_H
+
+#include <string>
+#include <string_view>
+
+/**
+ * Strings of the JSON reports that aoc_bench and aoc_runner write.
+ */
+namespace json {
+
+    /**
+     * The text as the contents of a JSON string. Quotes, backslashes and control characters, e.g.
+     * the newlines of an error message, are escaped.
+     */
+    std::string escape(std::string_view text);
+
+    /**
+     * The escaped text in quotes.
+     */
+    std::string quote(std::string_view text);
+
+}
+
+#endif
@@ -0,0 +1,95 @@
+
+#include "logging.h"
+
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+
+namespace {
+
+    constexpr std::array<std::string_view, 6> LEVEL_NAMES{"trace", "debug", "info", "warning", "error", "off"};
+
+    logging::Level levelFromEnvironment() {
+        const char *value = std::getenv("AOC_LOG");
+        if (value != nullptr) {
+            for (size_t i = 0; i < LEVEL_NAMES.size(); i++) {
+                if (LEVEL_NAMES[i] == value) {
+                    return static_cast<logging::Level>(i);
+                }
+            }
+        }
+        return logging::Level::Info;
+    }
+
+    std::atomic<logging::Level> &currentLevel() {
+        static std::atomic<logging::Level> level{levelFromEnvironment()};
+        return level;
+    }
+
+    struct SinkState {
+        std::mutex mutex;
+        logging::Sink sink = logging::stderrSink;
+    };
+
+    SinkState &sinkState() {
+        static SinkState state{};
+        return state;
+    }
+
+}
+
+namespace logging {
+
+    void stderrSink(Level level, std::string_view message) {
+        std::cerr << '[' << LEVEL_NAMES[static_cast<size_t>(level)] << "] " << message << '\n';
+    }
+
+    void setSink(Sink sink) {
+        auto &state = sinkState();
+        std::lock_guard lock(state.mutex);
+        state.sink = std::move(sink);
+    }
+
+    void setLevel(Level level) {
+        currentLevel() = level;
+    }
+
+    Level level() {
+        return currentLevel();
+    }
+
+    bool isEnabled(Level level) {
+        return level >= COMPILED_LEVEL && level >= currentLevel().load(std::memory_order_relaxed) &&
+               level != Level::Off;
+    }
+
+    void write(Level level, std::string_view message) {
+        auto &state = sinkState();
+        std::lock_guard lock(state.mutex);
+        if (state.sink) {
+            state.sink(level, message);
+        }
+    }
+
+    void writeAll(int fd, std::string_view text) {
+        while (!text.empty()) {
+            auto written = ::write(fd, text.data(), text.size());
+            if (written == -1) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return;
+            }
+            text.remove_prefix(static_cast<size_t>(written));
+        }
+    }
+
+    void BufferedOutput::flush() {
+        writeAll(m_fd, m_buffer.str());
+        m_buffer.str({});
+    }
+
+}
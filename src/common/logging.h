@@ -0,0 +1,133 @@
+
+#ifndef AOC_2023_LOGGING_H
+#define AOC_2023_LOGGING_H
+
+#include <functional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <unistd.h>
+
+/**
+ * Leveled logging for solver diagnostics, going to stderr unless another sink is set.
+ *
+ * Statements below AOC_LOG_LEVEL (0 trace, 1 debug, 2 info, 3 warning, 4 error) compile to nothing,
+ * including the evaluation of their message, so that grid dumps in hot loops cost nothing in
+ * Release builds. The build sets the level, see common/CMakeLists.txt. The compiled-in statements
+ * are filtered once more at runtime by setLevel() or the AOC_LOG environment variable.
+ */
+#ifndef AOC_LOG_LEVEL
+#define AOC_LOG_LEVEL 2
+#endif
+
+namespace logging {
+
+    enum class Level { Trace = 0, Debug = 1, Info = 2, Warning = 3, Error = 4, Off = 5 };
+
+    constexpr Level COMPILED_LEVEL = static_cast<Level>(AOC_LOG_LEVEL);
+
+    /**
+     * Receives whole messages. Called under a lock, so sinks need not be thread-safe.
+     */
+    using Sink = std::function<void(Level level, std::string_view message)>;
+
+    /**
+     * "[debug] message" lines written to stderr.
+     */
+    void stderrSink(Level level, std::string_view message);
+
+    void setSink(Sink sink);
+
+    /**
+     * Defaults to info, or to the level named by AOC_LOG ("trace", "debug", ..., "off").
+     */
+    void setLevel(Level level);
+
+    Level level();
+
+    bool isEnabled(Level level);
+
+    void write(Level level, std::string_view message);
+
+    /**
+     * Writes the whole text to a file descriptor, resuming after interruptions and partial writes.
+     * Stops at the first error, e.g. a closed pipe.
+     */
+    void writeAll(int fd, std::string_view text);
+
+    /**
+     * Collects output in memory and writes it to a file descriptor in one call on flush() and
+     * destruction, instead of a flush per std::endl.
+     */
+    class BufferedOutput {
+    public:
+        explicit BufferedOutput(int fd = STDOUT_FILENO) : m_fd(fd) {
+        }
+
+        BufferedOutput(const BufferedOutput &) = delete;
+
+        BufferedOutput &operator=(const BufferedOutput &) = delete;
+
+        ~BufferedOutput() {
+            flush();
+        }
+
+        template<typename T>
+        BufferedOutput &operator<<(const T &value) {
+            m_buffer << value;
+            return *this;
+        }
+
+        void flush();
+
+    private:
+        int m_fd;
+        std::ostringstream m_buffer;
+    };
+
+}
+
+#define AOC_LOG(level, message)                                         \
+    do {                                                                \
+        if (logging::isEnabled(level)) {                                \
+            std::ostringstream aocLogMessage{};                         \
+            aocLogMessage << message;                                   \
+            logging::write(level, aocLogMessage.str());                 \
+        }                                                               \
+    } while (false)
+
+#define AOC_LOG_DISABLED(message) \
+    do {                          \
+    } while (false)
+
+#if AOC_LOG_LEVEL <= 0
+#define AOC_LOG_TRACE(message) AOC_LOG(logging::Level::Trace, message)
+#else
+#define AOC_LOG_TRACE(message) AOC_LOG_DISABLED(message)
+#endif
+
+#if AOC_LOG_LEVEL <= 1
+#define AOC_LOG_DEBUG(message) AOC_LOG(logging::Level::Debug, message)
+#else
+#define AOC_LOG_DEBUG(message) AOC_LOG_DISABLED(message)
+#endif
+
+#if AOC_LOG_LEVEL <= 2
+#define AOC_LOG_INFO(message) AOC_LOG(logging::Level::Info, message)
+#else
+#define AOC_LOG_INFO(message) AOC_LOG_DISABLED(message)
+#endif
+
+#if AOC_LOG_LEVEL <= 3
+#define AOC_LOG_WARNING(message) AOC_LOG(logging::Level::Warning, message)
+#else
+#define AOC_LOG_WARNING(message) AOC_LOG_DISABLED(message)
+#endif
+
+#if AOC_LOG_LEVEL <= 4
+#define AOC_LOG_ERROR(message) AOC_LOG(logging::Level::Error, message)
+#else
+#define AOC_LOG_ERROR(message) AOC_LOG_DISABLED(message)
+#endif
+
+#endif
@@ -0,0 +1,52 @@
+
+#ifndef AOC_2023_OUTPUT_SILENCER_H
+#define AOC_2023_OUTPUT_SILENCER_H
+
+#include <algorithm>
+#include <cstdio>
+#include <fcntl.h>
+#include <iostream>
+#include <unistd.h>
+
+#include "logging.h"
+
+/**
+ * Points stdout to /dev/null for its lifetime. Solvers print diagnostics, which must not
+ * end up in reports. Works on the file descriptor, so both iostreams and stdio are covered.
+ * Solver logs below warnings are turned off as well.
+ */
+class OutputSilencer {
+public:
+    OutputSilencer() : m_savedLevel(logging::level()) {
+        logging::setLevel(std::max(m_savedLevel, logging::Level::Warning));
+        std::cout.flush();
+        std::fflush(stdout);
+        m_savedStdout = dup(STDOUT_FILENO);
+        int devNull = open("/dev/null", O_WRONLY);
+        if (m_savedStdout != -1 && devNull != -1) {
+            dup2(devNull, STDOUT_FILENO);
+        }
+        if (devNull != -1) {
+            close(devNull);
+        }
+    }
+
+    ~OutputSilencer() {
+        std::cout.flush();
+        std::fflush(stdout);
+        if (m_savedStdout != -1) {
+            dup2(m_savedStdout, STDOUT_FILENO);
+            close(m_savedStdout);
+        }
+        logging::setLevel(m_savedLevel);
+    }
+
+    OutputSilencer(const OutputSilencer &) = delete;
+    OutputSilencer &operator=(const OutputSilencer &) = delete;
+
+private:
+    logging::Level m_savedLevel;
+    int m_savedStdout;
+};
+
+#endif
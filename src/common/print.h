@@ -2,9 +2,15 @@
 #ifndef AOC_2023_PRINT_H
 #define AOC_2023_PRINT_H
 
+#include <array>
+#include <string>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 #include <sstream>
+#include <unistd.h>
 #include "array2d.h"
+#include "logging.h"
 
 template<typename T>
 inline std::string toString(const T &elem) {
@@ -48,20 +54,177 @@ inline std::ostream &operator<<(std::ostream &out, const std::vector<T> &data) {
     return out;
 }
 
-template<typename T>
-inline std::ostream &operator<<(std::ostream &out, const Array2D<T> &data) {
-    out << '[' << std::endl;
+template<typename T, typename Allocator>
+inline std::ostream &operator<<(std::ostream &out, const Array2D<T, Allocator> &data) {
+    out << '[' << '\n';
     for (size_t row = 0; row < data.rows(); row++) {
         out << '[';
         for (size_t col = 0; col < data.cols() - 1; col++) {
             out << data(row, col) << ',';
         }
         out << data(row, data.cols() - 1);
-        out << ']' << std::endl;
+        out << ']' << '\n';
     }
     out << ']';
     return out;
 }
 
+/**
+ * The character a grid cell is drawn as. Characters are drawn as themselves, numbers as '.' for
+ * zero, their digit up to 9 and '#' above, anything else as the first character it streams to.
+ * Specialize it for cell types that need other glyphs.
+ */
+template<typename T>
+struct Glyph {
+    static char of(const T &cell) {
+        if constexpr (std::is_same_v<T, char>) {
+            return cell;
+        } else if constexpr (std::is_integral_v<T>) {
+            if (cell <= 0) {
+                return cell == 0 ? '.' : '-';
+            }
+            return cell <= 9 ? static_cast<char>('0' + cell) : '#';
+        } else {
+            std::ostringstream out;
+            out << cell;
+            auto text = out.str();
+            return text.empty() ? '?' : text.front();
+        }
+    }
+};
+
+namespace detail {
+
+    template<typename T>
+    constexpr bool hasGlyphTable =
+            std::is_enum_v<T> || (std::is_integral_v<T> && !std::is_same_v<T, bool> && sizeof(T) == 1);
+
+    /**
+     * Glyph<T>::of() of every byte value, so that enums and byte-sized cells cost a load per cell.
+     */
+    template<typename T>
+    const std::array<char, 256> &glyphTable() {
+        static const std::array<char, 256> table = []() {
+            std::array<char, 256> glyphs{};
+            for (size_t value = 0; value < glyphs.size(); value++) {
+                // Most values are not valid enumerators, printers may reject them.
+                try {
+                    glyphs[value] = Glyph<T>::of(static_cast<T>(value));
+                } catch (...) {
+                    glyphs[value] = '?';
+                }
+            }
+            return glyphs;
+        }();
+        return table;
+    }
+
+    template<typename T>
+    char glyph(const T &cell) {
+        if constexpr (hasGlyphTable<T>) {
+            using Underlying = typename std::conditional_t<std::is_enum_v<T>, std::underlying_type<T>,
+                    std::type_identity<T>>::type;
+            auto value = static_cast<std::make_unsigned_t<Underlying>>(cell);
+            if (value < 256) {
+                return glyphTable<T>()[value];
+            }
+        }
+        return Glyph<T>::of(cell);
+    }
+
+}
+
+/**
+ * Draws grids one glyph per cell into a reused buffer and writes each frame with a single write
+ * call. In diff mode, a frame of the same size as the previous one is drawn as ANSI cursor moves
+ * to the runs of cells that changed, which keeps animating a grid cheap.
+ */
+template<typename T>
+class GridRenderer {
+public:
+    explicit GridRenderer(int fd = STDOUT_FILENO, bool diff = false) : m_fd(fd), m_diff(diff) {
+    }
+
+    /**
+     * The grid as text, one line per row. Valid until the next call.
+     */
+    template<typename Allocator>
+    const std::string &format(const Array2D<T, Allocator> &grid) {
+        m_frame.resize(grid.rows() * (grid.cols() + 1));
+        char *out = m_frame.data();
+        auto cell = grid.cbegin();
+        for (size_t row = 0; row < grid.rows(); row++) {
+            for (size_t col = 0; col < grid.cols(); col++, ++cell) {
+                *out++ = detail::glyph<T>(*cell);
+            }
+            *out++ = '\n';
+        }
+        return m_frame;
+    }
+
+    template<typename Allocator>
+    void render(const Array2D<T, Allocator> &grid) {
+        format(grid);
+        if (!m_diff) {
+            logging::writeAll(m_fd, m_frame);
+            return;
+        }
+
+        m_output.clear();
+        if (grid.rows() != m_rows || grid.cols() != m_cols) {
+            // Clear the screen and draw the whole frame from the top left corner.
+            m_output += "\x1b[2J\x1b[H";
+            m_output += m_frame;
+        } else {
+            appendChanges();
+        }
+        m_output += "\x1b[" + std::to_string(grid.rows() + 1) + ";1H";
+        logging::writeAll(m_fd, m_output);
+
+        m_rows = grid.rows();
+        m_cols = grid.cols();
+        m_previous.swap(m_frame);
+    }
+
+private:
+    int m_fd;
+    bool m_diff;
+    std::string m_frame;
+    std::string m_previous;
+    std::string m_output;
+    size_t m_rows = 0;
+    size_t m_cols = 0;
+
+    void appendChanges() {
+        size_t stride = m_cols + 1;
+        for (size_t row = 0; row < m_rows; row++) {
+            size_t col = 0;
+            while (col < m_cols) {
+                size_t index = row * stride + col;
+                if (m_frame[index] == m_previous[index]) {
+                    col++;
+                    continue;
+                }
+                size_t end = col;
+                while (end < m_cols && m_frame[row * stride + end] != m_previous[row * stride + end]) {
+                    end++;
+                }
+                m_output += "\x1b[" + std::to_string(row + 1) + ";" + std::to_string(col + 1) + "H";
+                m_output.append(m_frame, index, end - col);
+                col = end;
+            }
+        }
+    }
+};
+
+/**
+ * The grid as text, one glyph per cell and one line per row.
+ */
+template<typename T, typename Allocator>
+inline std::string renderGrid(const Array2D<T, Allocator> &grid) {
+    GridRenderer<T> renderer{};
+    return renderer.format(grid);
+}
+
 
 #endif
@@ -0,0 +1,89 @@
+#include "profiling.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string_view>
+#include "logging.h"
+
+namespace {
+
+    std::atomic<bool> &enabledFlag() {
+        static std::atomic<bool> flag{[]() {
+            const char *value = std::getenv("AOC_PROFILE");
+            return value != nullptr && std::strcmp(value, "1") == 0;
+        }()};
+        return flag;
+    }
+
+    struct Registry {
+        std::mutex mutex;
+        std::map<std::string, profiling::ZoneStats, std::less<>> zones;
+    };
+
+    Registry &registry() {
+        static Registry registry{};
+        return registry;
+    }
+
+}
+
+namespace profiling {
+
+    void setEnabled(bool enabled) {
+        enabledFlag().store(enabled, std::memory_order_relaxed);
+    }
+
+    bool enabled() {
+        return enabledFlag().load(std::memory_order_relaxed);
+    }
+
+    void calibrateCounter() {
+        if (enabled() || logging::isEnabled(logging::Level::Info)) {
+            cycles::nanosecondsPerCycle();
+        }
+    }
+
+    void record(const char *name, uint64_t cycles) {
+        auto &registry = ::registry();
+        std::lock_guard lock(registry.mutex);
+        auto it = registry.zones.find(std::string_view(name));
+        if (it == registry.zones.end()) {
+            it = registry.zones.emplace(name, ZoneStats{.name = name}).first;
+        }
+        it->second.calls++;
+        it->second.cycles += cycles;
+    }
+
+    std::vector<ZoneStats> zones() {
+        auto &registry = ::registry();
+        std::vector<ZoneStats> totals{};
+        {
+            std::lock_guard lock(registry.mutex);
+            for (const auto &[name, stats]: registry.zones) {
+                totals.push_back(stats);
+            }
+        }
+        std::stable_sort(totals.begin(), totals.end(), [](const ZoneStats &a, const ZoneStats &b) {
+            return a.cycles > b.cycles;
+        });
+        return totals;
+    }
+
+    void reset() {
+        auto &registry = ::registry();
+        std::lock_guard lock(registry.mutex);
+        registry.zones.clear();
+    }
+
+    void report(std::ostream &out) {
+        for (const auto &zone: zones()) {
+            out << "[Profile] " << zone.name << ": " << zone.calls << (zone.calls == 1 ? " call, " : " calls, ")
+                << cycles::toNanoseconds(zone.cycles) * 1e-6 << " ms\n";
+        }
+    }
+
+}
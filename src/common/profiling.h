@@ -0,0 +1,91 @@
+
+#ifndef AOC_2023_PROFILING_H
+#define AOC_2023_PROFILING_H
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "cycle_timer.h"
+
+/**
+ * Named zones timed with the time-stamp counter, for coarse regions such as the phases of a
+ * solver. Zones add up the cycles and calls of every region of their name, across threads, and
+ * runDay() prints the totals when profiling is on. While off, a zone costs a relaxed load.
+ *
+ * Zones take a lock when they end, so they do not belong in inner loops; see CycleTimer there.
+ */
+namespace profiling {
+
+    /**
+     * Defaults to on when AOC_PROFILE is "1".
+     */
+    void setEnabled(bool enabled);
+
+    bool enabled();
+
+    /**
+     * Calibrates the cycle counter when profiling or info logs are on, as both convert cycles to
+     * time. Harnesses call it before timing anything, so that no timed part pays for calibration.
+     */
+    void calibrateCounter();
+
+    struct ZoneStats {
+        std::string name;
+        uint64_t calls = 0;
+        uint64_t cycles = 0;
+    };
+
+    void record(const char *name, uint64_t cycles);
+
+    /**
+     * Totals of every zone, the most expensive first.
+     */
+    std::vector<ZoneStats> zones();
+
+    void reset();
+
+    /**
+     * One "name: calls, milliseconds" line per zone.
+     */
+    void report(std::ostream &out);
+
+    class Zone {
+    public:
+        /**
+         * The name must outlive the zone, e.g. a string literal.
+         */
+        explicit Zone(const char *name) {
+            if (enabled()) {
+                m_name = name;
+                m_start = cycles::readStart();
+            }
+        }
+
+        ~Zone() {
+            if (m_name != nullptr) {
+                record(m_name, cycles::readStop() - m_start);
+            }
+        }
+
+        Zone(const Zone &) = delete;
+
+        Zone &operator=(const Zone &) = delete;
+
+    private:
+        const char *m_name = nullptr;
+        // Read only while enabled, so that a disabled zone costs no counter read.
+        uint64_t m_start = 0;
+    };
+
+}
+
+#define AOC_PROFILE_CONCAT_INNER(a, b) a##b
+#define AOC_PROFILE_CONCAT(a, b) AOC_PROFILE_CONCAT_INNER(a, b)
+
+/**
+ * Times the rest of the enclosing scope as the zone of the given name.
+ */
+#define AOC_PROFILE_ZONE(name) profiling::Zone AOC_PROFILE_CONCAT(aocProfileZone, __LINE__){name}
+
+#endif
@@ -0,0 +1,61 @@
+
+#include "scheduler.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+namespace {
+
+    scheduler::Options optionsFromEnvironment() {
+        scheduler::Options options{};
+        if (const char *threads = std::getenv("AOC_THREADS")) {
+            options.concurrency = std::max(0, std::atoi(threads));
+        }
+        if (const char *deterministic = std::getenv("AOC_DETERMINISTIC")) {
+            options.deterministic = std::string(deterministic) == "1";
+        }
+        return options;
+    }
+
+    struct State {
+        scheduler::Options options = optionsFromEnvironment();
+        std::unique_ptr<tbb::task_arena> arena = makeArena(options);
+
+        static std::unique_ptr<tbb::task_arena> makeArena(const scheduler::Options &options) {
+            if (options.concurrency > 0) {
+                return std::make_unique<tbb::task_arena>(options.concurrency);
+            }
+            return std::make_unique<tbb::task_arena>();
+        }
+    };
+
+    State &state() {
+        static State instance{};
+        return instance;
+    }
+
+}
+
+namespace scheduler {
+
+    void configure(const Options &options) {
+        auto &current = state();
+        current.options = options;
+        current.arena = State::makeArena(options);
+    }
+
+    const Options &options() {
+        return state().options;
+    }
+
+    int concurrency() {
+        return state().arena->max_concurrency();
+    }
+
+    tbb::task_arena &arena() {
+        return *state().arena;
+    }
+
+}
@@ -0,0 +1,148 @@
+
+#ifndef AOC_2023_SCHEDULER_H
+#define AOC_2023_SCHEDULER_H
+
+#include <cstddef>
+#include <utility>
+
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/task_arena.h>
+#include <tbb/task_group.h>
+
+#include "arena.h"
+
+/**
+ * The one way solvers run in parallel: thin wrappers over TBB's work-stealing scheduler, all
+ * executing in a shared arena whose concurrency the harnesses limit.
+ *
+ * Grain sizes are per call, as the right chunk size depends on the cost of one item.
+ * Bodies and tasks run with the stage arena suspended (see arena.h).
+ */
+namespace scheduler {
+
+    struct Options {
+        // Worker threads of the arena, 0 means one per hardware thread.
+        int concurrency = 0;
+        // Reductions split and combine in the same order regardless of the number of workers, so that
+        // results of non-associative combinations (e.g. floating-point sums) are reproducible.
+        bool deterministic = false;
+    };
+
+    /**
+     * Replaces the arena. Must not be called while parallel work is running.
+     * The initial options come from AOC_THREADS and AOC_DETERMINISTIC=1.
+     */
+    void configure(const Options &options);
+
+    const Options &options();
+
+    int concurrency();
+
+    tbb::task_arena &arena();
+
+    /**
+     * Calls body(i) for every i in [begin, end).
+     */
+    template<typename Index, typename Body>
+    void parallelFor(Index begin, Index end, Body &&body, size_t grainSize = 1) {
+        arena().execute([&]() {
+            tbb::parallel_for(tbb::blocked_range<Index>(begin, end, grainSize),
+                              [&](const tbb::blocked_range<Index> &range) {
+                                  arena::Suspend suspend{};
+                                  for (Index i = range.begin(); i != range.end(); ++i) {
+                                      body(i);
+                                  }
+                              });
+        });
+    }
+
+    /**
+     * Combines map(i) of every i in [begin, end), starting from the identity.
+     */
+    template<typename T, typename Index, typename Map, typename Combine>
+    T parallelReduce(Index begin, Index end, T identity, Map &&map, Combine &&combine, size_t grainSize = 1) {
+        auto reduceRange = [&](const tbb::blocked_range<Index> &range, T partial) {
+            arena::Suspend suspend{};
+            for (Index i = range.begin(); i != range.end(); ++i) {
+                partial = combine(std::move(partial), map(i));
+            }
+            return partial;
+        };
+
+        T result = identity;
+        arena().execute([&]() {
+            tbb::blocked_range<Index> range(begin, end, grainSize);
+            if (options().deterministic) {
+                result = tbb::parallel_deterministic_reduce(range, identity, reduceRange, combine);
+            } else {
+                result = tbb::parallel_reduce(range, identity, reduceRange, combine);
+            }
+        });
+        return result;
+    }
+
+    /**
+     * Number of i in [begin, end) satisfying the predicate.
+     */
+    template<typename Index, typename Predicate>
+    size_t parallelCount(Index begin, Index end, Predicate &&predicate, size_t grainSize = 1) {
+        return parallelReduce(begin, end, size_t{0}, [&](Index i) -> size_t { return predicate(i) ? 1 : 0; },
+                              [](size_t a, size_t b) { return a + b; }, grainSize);
+    }
+
+    /**
+     * Tasks spawned into the shared arena. wait() must be called before destruction.
+     */
+    class TaskGroup {
+    public:
+        template<typename Function>
+        void run(Function &&function) {
+            arena().execute([&]() {
+                m_group.run([task = std::forward<Function>(function)]() {
+                    arena::Suspend suspend{};
+                    task();
+                });
+            });
+        }
+
+        void wait() {
+            arena().execute([&]() { m_group.wait(); });
+        }
+
+    private:
+        tbb::task_group m_group;
+    };
+
+    /**
+     * Scratch storage of each worker, created on a worker's first local() call by copying the
+     * exemplar. In deterministic mode too, which worker processed which item is not reproducible.
+     */
+    template<typename T>
+    class PerWorker {
+    public:
+        PerWorker() = default;
+
+        explicit PerWorker(const T &exemplar) : m_storage(exemplar) {
+        }
+
+        T &local() {
+            return m_storage.local();
+        }
+
+        template<typename Function>
+        void forEach(Function &&function) {
+            for (auto &value: m_storage) {
+                function(value);
+            }
+        }
+
+    private:
+        tbb::enumerable_thread_specific<T> m_storage;
+    };
+
+}
+
+#endif
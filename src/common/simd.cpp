@@ -0,0 +1,216 @@
+
+#include "simd.h"
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+#if defined(__x86_64__)
+#include <cpuid.h>
+#endif
+
+#include "logging.h"
+#include "simd_kernels.h"
+
+namespace {
+
+    constexpr std::array<std::string_view, 3> ISA_NAMES{"scalar", "avx2", "avx512"};
+
+    const char *findByteScalar(const char *begin, const char *end, char byte) {
+        for (; begin != end; begin++) {
+            if (*begin == byte) {
+                return begin;
+            }
+        }
+        return end;
+    }
+
+    size_t countByteScalar(const char *data, size_t size, char byte) {
+        size_t count = 0;
+        for (size_t i = 0; i < size; i++) {
+            count += data[i] == byte;
+        }
+        return count;
+    }
+
+    int64_t sumScalar(const int32_t *values, size_t size) {
+        int64_t total = 0;
+        for (size_t i = 0; i < size; i++) {
+            total += values[i];
+        }
+        return total;
+    }
+
+    __int128 sumWideScalar(const int64_t *values, size_t size) {
+        __int128 total = 0;
+        for (size_t i = 0; i < size; i++) {
+            total += values[i];
+        }
+        return total;
+    }
+
+    uint64_t popcountScalar(const uint64_t *words, size_t size) {
+        uint64_t count = 0;
+        for (size_t i = 0; i < size; i++) {
+            count += static_cast<uint64_t>(__builtin_popcountll(words[i]));
+        }
+        return count;
+    }
+
+#if defined(__x86_64__)
+    uint64_t readXcr0() {
+        uint32_t low;
+        uint32_t high;
+        asm volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+        return (static_cast<uint64_t>(high) << 32) | low;
+    }
+#endif
+
+    /**
+     * The CPU must implement the instructions and the OS must save the wider registers on context
+     * switches, which XCR0 tells.
+     */
+    simd::Isa detect() {
+#if defined(__x86_64__)
+        unsigned eax, ebx, ecx, edx;
+        if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+            return simd::Isa::Scalar;
+        }
+        bool osSavesState = ecx & bit_OSXSAVE;
+        bool hasAvx = ecx & bit_AVX;
+        bool hasPopcnt = ecx & bit_POPCNT;
+        if (!osSavesState || !hasAvx || !hasPopcnt || !__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+            return simd::Isa::Scalar;
+        }
+
+        auto xcr0 = readXcr0();
+        bool osSavesYmm = (xcr0 & 0x6) == 0x6;
+        bool osSavesZmm = (xcr0 & 0xE6) == 0xE6;
+        bool hasAvx2 = (ebx & bit_AVX2) && (ebx & bit_BMI);
+        if (osSavesZmm && hasAvx2 && (ebx & bit_AVX512F) && (ebx & bit_AVX512BW) && (ebx & bit_BMI2)) {
+            return simd::Isa::Avx512;
+        }
+        if (osSavesYmm && hasAvx2) {
+            return simd::Isa::Avx2;
+        }
+#endif
+        return simd::Isa::Scalar;
+    }
+
+    const simd::kernels::Table &tableOf(simd::Isa isa) {
+        switch (isa) {
+#if defined(__x86_64__)
+            case simd::Isa::Avx512:
+                return simd::kernels::AVX512;
+            case simd::Isa::Avx2:
+                return simd::kernels::AVX2;
+#endif
+            default:
+                return simd::kernels::SCALAR;
+        }
+    }
+
+    simd::Isa initialIsa() {
+        auto isa = simd::detectedIsa();
+        const char *forced = std::getenv("AOC_FORCE_ISA");
+        if (forced == nullptr) {
+            return isa;
+        }
+        try {
+            auto requested = simd::parseIsa(forced);
+            if (requested <= isa) {
+                return requested;
+            }
+            AOC_LOG_WARNING("AOC_FORCE_ISA=" << forced << " is not supported by this host, using "
+                                             << simd::name(isa));
+        } catch (const std::invalid_argument &exception) {
+            AOC_LOG_WARNING(exception.what());
+        }
+        return isa;
+    }
+
+    struct Dispatch {
+        std::atomic<simd::Isa> isa;
+        std::atomic<const simd::kernels::Table *> table;
+
+        Dispatch() : isa(initialIsa()), table(&tableOf(isa)) {
+        }
+    };
+
+    Dispatch &dispatch() {
+        static Dispatch instance{};
+        return instance;
+    }
+
+    const simd::kernels::Table &active() {
+        return *dispatch().table.load(std::memory_order_relaxed);
+    }
+
+}
+
+namespace simd::kernels {
+
+    const Table SCALAR{findByteScalar, countByteScalar, sumScalar, sumWideScalar, popcountScalar};
+
+}
+
+namespace simd {
+
+    std::string_view name(Isa isa) {
+        return ISA_NAMES[static_cast<size_t>(isa)];
+    }
+
+    Isa parseIsa(std::string_view name) {
+        for (size_t i = 0; i < ISA_NAMES.size(); i++) {
+            if (ISA_NAMES[i] == name) {
+                return static_cast<Isa>(i);
+            }
+        }
+        throw std::invalid_argument("Unknown ISA: " + std::string(name));
+    }
+
+    Isa detectedIsa() {
+        static const Isa isa = detect();
+        return isa;
+    }
+
+    Isa activeIsa() {
+        return dispatch().isa;
+    }
+
+    void forceIsa(Isa isa) {
+        if (isa > detectedIsa()) {
+            throw std::invalid_argument("ISA not supported by this host: " + std::string(name(isa)));
+        }
+        dispatch().table = &tableOf(isa);
+        dispatch().isa = isa;
+    }
+
+    size_t findByte(std::string_view text, char byte, size_t from) {
+        if (from >= text.size()) {
+            return std::string_view::npos;
+        }
+        const char *end = text.data() + text.size();
+        const char *found = active().findByte(text.data() + from, end, byte);
+        return found == end ? std::string_view::npos : static_cast<size_t>(found - text.data());
+    }
+
+    size_t countByte(std::string_view text, char byte) {
+        return active().countByte(text.data(), text.size(), byte);
+    }
+
+    int64_t sum(std::span<const int32_t> values) {
+        return active().sum(values.data(), values.size());
+    }
+
+    __int128 sum(std::span<const int64_t> values) {
+        return active().sumWide(values.data(), values.size());
+    }
+
+    uint64_t popcount(std::span<const uint64_t> words) {
+        return active().popcount(words.data(), words.size());
+    }
+
+}
@@ -0,0 +1,69 @@
+
+#ifndef AOC_2023_SIMD_H
+#define AOC_2023_SIMD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+/**
+ * Kernels built for several x86 ISA levels in one binary. The best level supported by the CPU and
+ * the OS is detected once through CPUID, so that the build needs no -march and the binary runs on
+ * any x86-64 host. Other architectures get the scalar kernels.
+ *
+ * AOC_FORCE_ISA=scalar|avx2|avx512 in the environment, or forceIsa(), selects a lower level,
+ * e.g. to test the kernels against each other.
+ */
+namespace simd {
+
+    enum class Isa { Scalar, Avx2, Avx512 };
+
+    std::string_view name(Isa isa);
+
+    /**
+     * Throws std::invalid_argument for unknown names.
+     */
+    Isa parseIsa(std::string_view name);
+
+    /**
+     * The best level the host supports.
+     */
+    Isa detectedIsa();
+
+    /**
+     * The level the kernels run at.
+     */
+    Isa activeIsa();
+
+    /**
+     * Throws std::invalid_argument when the host does not support the level.
+     */
+    void forceIsa(Isa isa);
+
+    /**
+     * Position of the first occurrence of the byte at or after `from`, std::string_view::npos if none.
+     */
+    size_t findByte(std::string_view text, char byte, size_t from = 0);
+
+    size_t countByte(std::string_view text, char byte);
+
+    /**
+     * Sums in 64 bits, so that the sum of 32-bit values cannot overflow.
+     */
+    int64_t sum(std::span<const int32_t> values);
+
+    /**
+     * Sums exactly in 128 bits. The lanes add in 64 bits and count their overflows, which carry into
+     * the total at the end.
+     */
+    __int128 sum(std::span<const int64_t> values);
+
+    /**
+     * Number of set bits in the words of a bitset.
+     */
+    uint64_t popcount(std::span<const uint64_t> words);
+
+}
+
+#endif
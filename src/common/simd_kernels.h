@@ -0,0 +1,32 @@
+
+#ifndef AOC_2023_SIMD_KERNELS_H
+#define AOC_2023_SIMD_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Implementations behind simd.h, one table per ISA level. The kernels take raw pointers, so that
+ * no inline library code is instantiated inside the ISA-specific functions.
+ */
+namespace simd::kernels {
+
+    struct Table {
+        // Pointer to the first occurrence of the byte in [begin, end), or end.
+        const char *(*findByte)(const char *begin, const char *end, char byte);
+        size_t (*countByte)(const char *data, size_t size, char byte);
+        int64_t (*sum)(const int32_t *values, size_t size);
+        __int128 (*sumWide)(const int64_t *values, size_t size);
+        uint64_t (*popcount)(const uint64_t *words, size_t size);
+    };
+
+    extern const Table SCALAR;
+
+#if defined(__x86_64__)
+    extern const Table AVX2;
+    extern const Table AVX512;
+#endif
+
+}
+
+#endif
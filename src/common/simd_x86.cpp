@@ -0,0 +1,218 @@
+
+#include "simd_kernels.h"
+
+#if defined(__x86_64__)
+
+#include <immintrin.h>
+
+/**
+ * The functions are compiled for their ISA through target attributes rather than -m flags, so that
+ * the rest of the translation unit, and any inline code it instantiates, stays baseline x86-64.
+ */
+#define AOC_AVX2 __attribute__((target("avx2,popcnt,bmi")))
+#define AOC_AVX512 __attribute__((target("avx512f,avx512bw,avx2,popcnt,bmi,bmi2")))
+
+namespace {
+
+    AOC_AVX2 const char *findByteAvx2(const char *begin, const char *end, char byte) {
+        auto needle = _mm256_set1_epi8(byte);
+        for (; end - begin >= 32; begin += 32) {
+            auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(begin));
+            auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, needle)));
+            if (mask != 0) {
+                return begin + _tzcnt_u32(mask);
+            }
+        }
+        for (; begin != end; begin++) {
+            if (*begin == byte) {
+                return begin;
+            }
+        }
+        return end;
+    }
+
+    AOC_AVX2 size_t countByteAvx2(const char *data, size_t size, char byte) {
+        auto needle = _mm256_set1_epi8(byte);
+        size_t count = 0;
+        size_t i = 0;
+        for (; i + 32 <= size; i += 32) {
+            auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+            auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, needle)));
+            count += _mm_popcnt_u32(mask);
+        }
+        for (; i < size; i++) {
+            count += data[i] == byte;
+        }
+        return count;
+    }
+
+    AOC_AVX2 int64_t sumAvx2(const int32_t *values, size_t size) {
+        auto low = _mm256_setzero_si256();
+        auto high = _mm256_setzero_si256();
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8) {
+            auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + i));
+            low = _mm256_add_epi64(low, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(chunk)));
+            high = _mm256_add_epi64(high, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(chunk, 1)));
+        }
+        auto lanes = _mm256_add_epi64(low, high);
+        auto halves = _mm_add_epi64(_mm256_castsi256_si128(lanes), _mm256_extracti128_si256(lanes, 1));
+        int64_t total = _mm_cvtsi128_si64(halves) + _mm_extract_epi64(halves, 1);
+        for (; i < size; i++) {
+            total += values[i];
+        }
+        return total;
+    }
+
+    /**
+     * A lane overflowed when the addend and the old sum agree in sign and the new sum does not, and
+     * then wrapped by 2^64 against the sign of the addend. Each lane counts its wraps in a second
+     * vector, so the loop stays in 64-bit adds.
+     */
+    AOC_AVX2 __int128 sumWideAvx2(const int64_t *values, size_t size) {
+        auto zero = _mm256_setzero_si256();
+        auto one = _mm256_set1_epi64x(1);
+        auto sums = _mm256_setzero_si256();
+        auto carries = _mm256_setzero_si256();
+        size_t i = 0;
+        for (; i + 4 <= size; i += 4) {
+            auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + i));
+            auto next = _mm256_add_epi64(sums, chunk);
+            auto wrapped = _mm256_and_si256(_mm256_xor_si256(sums, next), _mm256_xor_si256(chunk, next));
+            auto overflowed = _mm256_cmpgt_epi64(zero, wrapped);
+            // +1 for positive addends, -1 for negative ones.
+            auto direction = _mm256_or_si256(_mm256_cmpgt_epi64(zero, chunk), one);
+            carries = _mm256_add_epi64(carries, _mm256_and_si256(overflowed, direction));
+            sums = next;
+        }
+        int64_t laneSums[4];
+        int64_t laneCarries[4];
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(laneSums), sums);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(laneCarries), carries);
+        __int128 total = 0;
+        for (int lane = 0; lane < 4; lane++) {
+            total += laneSums[lane] + (static_cast<__int128>(laneCarries[lane]) << 64);
+        }
+        for (; i < size; i++) {
+            total += values[i];
+        }
+        return total;
+    }
+
+    /**
+     * Four independent counters keep the popcnt units busy.
+     */
+    AOC_AVX2 uint64_t popcountAvx2(const uint64_t *words, size_t size) {
+        uint64_t counts[4] = {};
+        size_t i = 0;
+        for (; i + 4 <= size; i += 4) {
+            for (int lane = 0; lane < 4; lane++) {
+                counts[lane] += _mm_popcnt_u64(words[i + lane]);
+            }
+        }
+        for (; i < size; i++) {
+            counts[0] += _mm_popcnt_u64(words[i]);
+        }
+        return counts[0] + counts[1] + counts[2] + counts[3];
+    }
+
+    // GCC 12's AVX-512 intrinsics start from _mm512_undefined_*() values, which it then reports as uninitialized.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+    AOC_AVX512 const char *findByteAvx512(const char *begin, const char *end, char byte) {
+        auto needle = _mm512_set1_epi8(byte);
+        for (; end - begin >= 64; begin += 64) {
+            auto mask = _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(begin), needle);
+            if (mask != 0) {
+                return begin + _tzcnt_u64(mask);
+            }
+        }
+        if (begin != end) {
+            // Masked load of the tail, the bytes past the end are not touched.
+            auto valid = _bzhi_u64(~0ULL, static_cast<unsigned>(end - begin));
+            auto mask = _mm512_mask_cmpeq_epi8_mask(valid, _mm512_maskz_loadu_epi8(valid, begin), needle);
+            return mask != 0 ? begin + _tzcnt_u64(mask) : end;
+        }
+        return end;
+    }
+
+    AOC_AVX512 size_t countByteAvx512(const char *data, size_t size, char byte) {
+        auto needle = _mm512_set1_epi8(byte);
+        size_t count = 0;
+        size_t i = 0;
+        for (; i + 64 <= size; i += 64) {
+            count += _mm_popcnt_u64(_mm512_cmpeq_epi8_mask(_mm512_loadu_si512(data + i), needle));
+        }
+        if (i < size) {
+            auto valid = _bzhi_u64(~0ULL, static_cast<unsigned>(size - i));
+            count += _mm_popcnt_u64(_mm512_mask_cmpeq_epi8_mask(valid, _mm512_maskz_loadu_epi8(valid, data + i),
+                                                                  needle));
+        }
+        return count;
+    }
+
+    AOC_AVX512 int64_t sumAvx512(const int32_t *values, size_t size) {
+        auto low = _mm512_setzero_si512();
+        auto high = _mm512_setzero_si512();
+        size_t i = 0;
+        for (; i + 16 <= size; i += 16) {
+            auto chunk = _mm512_loadu_si512(values + i);
+            low = _mm512_add_epi64(low, _mm512_cvtepi32_epi64(_mm512_castsi512_si256(chunk)));
+            high = _mm512_add_epi64(high, _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(chunk, 1)));
+        }
+        int64_t total = _mm512_reduce_add_epi64(_mm512_add_epi64(low, high));
+        for (; i < size; i++) {
+            total += values[i];
+        }
+        return total;
+    }
+
+    /**
+     * As sumWideAvx2(), with the overflow and sign tests in mask registers.
+     */
+    AOC_AVX512 __int128 sumWideAvx512(const int64_t *values, size_t size) {
+        auto zero = _mm512_setzero_si512();
+        auto one = _mm512_set1_epi64(1);
+        auto sums = _mm512_setzero_si512();
+        auto carries = _mm512_setzero_si512();
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8) {
+            auto chunk = _mm512_loadu_si512(values + i);
+            auto next = _mm512_add_epi64(sums, chunk);
+            auto wrapped = _mm512_and_si512(_mm512_xor_si512(sums, next), _mm512_xor_si512(chunk, next));
+            auto overflowed = _mm512_cmplt_epi64_mask(wrapped, zero);
+            auto negative = _mm512_cmplt_epi64_mask(chunk, zero);
+            carries = _mm512_mask_add_epi64(carries, overflowed & ~negative, carries, one);
+            carries = _mm512_mask_sub_epi64(carries, overflowed & negative, carries, one);
+            sums = next;
+        }
+        int64_t laneSums[8];
+        int64_t laneCarries[8];
+        _mm512_storeu_si512(laneSums, sums);
+        _mm512_storeu_si512(laneCarries, carries);
+        __int128 total = 0;
+        for (int lane = 0; lane < 8; lane++) {
+            total += laneSums[lane] + (static_cast<__int128>(laneCarries[lane]) << 64);
+        }
+        for (; i < size; i++) {
+            total += values[i];
+        }
+        return total;
+    }
+
+#pragma GCC diagnostic pop
+
+}
+
+namespace simd::kernels {
+
+    const Table AVX2{findByteAvx2, countByteAvx2, sumAvx2, sumWideAvx2, popcountAvx2};
+
+    // AVX-512 has no faster popcount without the VPOPCNTDQ extension, which not all of its hosts have.
+    const Table AVX512{findByteAvx512, countByteAvx512, sumAvx512, sumWideAvx512, popcountAvx2};
+
+}
+
+#endif
@@ -0,0 +1,219 @@
+
+#ifndef AOC_2023_SMALL_VECTOR_H
+#define AOC_2023_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+/**
+ * A vector whose first N elements are stored inline, for short per-record lists (levels of a
+ * report, operands of an equation) where a heap allocation per record would dominate. Once it
+ * outgrows N it continues on the heap like std::vector.
+ *
+ * Only the std::vector operations the solvers use are provided. Elements must be trivially
+ * copyable, so that growing and copying are plain memcpy.
+ */
+template<typename T, std::size_t N>
+class SmallVector {
+    static_assert(std::is_trivially_copyable_v<T>, "SmallVector holds trivially copyable elements only.");
+    static_assert(N > 0, "SmallVector needs inline capacity.");
+
+private:
+    T *m_data;
+    std::size_t m_size = 0;
+    std::size_t m_capacity = N;
+    T m_inline[N];
+
+    [[nodiscard]] bool isInline() const noexcept {
+        return m_data == m_inline;
+    }
+
+    void release() noexcept {
+        if (!isInline()) {
+            std::allocator<T>().deallocate(m_data, m_capacity);
+        }
+    }
+
+    void grow(std::size_t minCapacity) {
+        auto capacity = std::max(minCapacity, m_capacity * 2);
+        T *data = std::allocator<T>().allocate(capacity);
+        std::memcpy(data, m_data, m_size * sizeof(T));
+        release();
+        m_data = data;
+        m_capacity = capacity;
+    }
+
+    void copyFrom(const SmallVector &other) {
+        m_size = 0;
+        reserve(other.m_size);
+        std::memcpy(m_data, other.m_data, other.m_size * sizeof(T));
+        m_size = other.m_size;
+    }
+
+    void moveFrom(SmallVector &other) noexcept {
+        if (other.isInline()) {
+            m_data = m_inline;
+            m_capacity = N;
+            std::memcpy(m_inline, other.m_inline, other.m_size * sizeof(T));
+        } else {
+            m_data = other.m_data;
+            m_capacity = other.m_capacity;
+            other.m_data = other.m_inline;
+            other.m_capacity = N;
+        }
+        m_size = other.m_size;
+        other.m_size = 0;
+    }
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using iterator = T *;
+    using const_iterator = const T *;
+
+    SmallVector() noexcept: m_data(m_inline) {
+    }
+
+    SmallVector(std::size_t count, const T &value) : SmallVector() {
+        resize(count, value);
+    }
+
+    SmallVector(std::initializer_list<T> values) : SmallVector(values.begin(), values.end()) {
+    }
+
+    template<typename InputIt> requires std::input_iterator<InputIt>
+    SmallVector(InputIt first, InputIt last) : SmallVector() {
+        for (; first != last; ++first) {
+            push_back(*first);
+        }
+    }
+
+    SmallVector(const SmallVector &other) : SmallVector() {
+        copyFrom(other);
+    }
+
+    SmallVector(SmallVector &&other) noexcept: SmallVector() {
+        moveFrom(other);
+    }
+
+    SmallVector &operator=(const SmallVector &other) {
+        if (this != &other) {
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    SmallVector &operator=(SmallVector &&other) noexcept {
+        if (this != &other) {
+            release();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    ~SmallVector() {
+        release();
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return m_size; }
+
+    [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+
+    [[nodiscard]] std::size_t capacity() const noexcept { return m_capacity; }
+
+    /**
+     * Whether the elements are still in the inline storage.
+     */
+    [[nodiscard]] bool isSmall() const noexcept { return isInline(); }
+
+    T *data() noexcept { return m_data; }
+
+    const T *data() const noexcept { return m_data; }
+
+    T &operator[](std::size_t index) { return m_data[index]; }
+
+    const T &operator[](std::size_t index) const { return m_data[index]; }
+
+    const T &at(std::size_t index) const {
+        if (index >= m_size) {
+            throw std::out_of_range("SmallVector: Index out of bounds");
+        }
+        return m_data[index];
+    }
+
+    T &front() { return m_data[0]; }
+
+    const T &front() const { return m_data[0]; }
+
+    T &back() { return m_data[m_size - 1]; }
+
+    const T &back() const { return m_data[m_size - 1]; }
+
+    iterator begin() noexcept { return m_data; }
+
+    iterator end() noexcept { return m_data + m_size; }
+
+    const_iterator begin() const noexcept { return m_data; }
+
+    const_iterator end() const noexcept { return m_data + m_size; }
+
+    const_iterator cbegin() const noexcept { return m_data; }
+
+    const_iterator cend() const noexcept { return m_data + m_size; }
+
+    void reserve(std::size_t capacity) {
+        if (capacity > m_capacity) {
+            grow(capacity);
+        }
+    }
+
+    void resize(std::size_t size, const T &value = T()) {
+        reserve(size);
+        std::fill(m_data + std::min(size, m_size), m_data + size, value);
+        m_size = size;
+    }
+
+    void clear() noexcept {
+        m_size = 0;
+    }
+
+    void push_back(const T &value) {
+        if (m_size == m_capacity) {
+            // The value may be an element of this vector.
+            T copy = value;
+            grow(m_size + 1);
+            m_data[m_size++] = copy;
+            return;
+        }
+        m_data[m_size++] = value;
+    }
+
+    template<typename... Args>
+    T &emplace_back(Args &&...args) {
+        push_back(T(std::forward<Args>(args)...));
+        return back();
+    }
+
+    void pop_back() {
+        m_size--;
+    }
+
+    iterator erase(const_iterator position) {
+        auto index = static_cast<std::size_t>(position - m_data);
+        std::memmove(m_data + index, m_data + index + 1, (m_size - index - 1) * sizeof(T));
+        m_size--;
+        return m_data + index;
+    }
+
+    friend bool operator==(const SmallVector &lhs, const SmallVector &rhs) {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+};
+
+#endif
@@ -0,0 +1,152 @@
+
+#include "solver.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+
+#include "allocations.h"
+#include "cache.h"
+#include "checked.h"
+#include "huge_pages.h"
+#include "logging.h"
+#include "profiling.h"
+#include "timer.h"
+
+namespace {
+
+    std::vector<solver::Day> &registry() {
+        static std::vector<solver::Day> days{};
+        return days;
+    }
+
+}
+
+namespace solver {
+
+    Answer::Answer(__int128 number) : value(checked::toString(number)) {
+    }
+
+    std::ostream &operator<<(std::ostream &out, const Answer &answer) {
+        return out << answer.value;
+    }
+
+    bool add(Day day) {
+        registry().push_back(std::move(day));
+        return true;
+    }
+
+    std::vector<Day> days() {
+        auto sorted = registry();
+        std::sort(sorted.begin(), sorted.end(), [](const Day &a, const Day &b) {
+            return a.day < b.day;
+        });
+        return sorted;
+    }
+
+    const Day &find(int day) {
+        const auto &days = registry();
+        auto it = std::find_if(days.begin(), days.end(), [day](const Day &registered) {
+            return registered.day == day;
+        });
+        if (it == days.end()) {
+            throw std::invalid_argument("No solver for day " + std::to_string(day));
+        }
+        return *it;
+    }
+
+    std::string readInput(const std::string &path) {
+        std::string content{};
+        readInput(path, content);
+        return content;
+    }
+
+    void readInput(const std::string &path, std::string &buffer) {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) {
+            throw std::ios_base::failure("Cannot open input file: " + path);
+        }
+        auto size = static_cast<std::streamsize>(file.tellg());
+        // Advised before the first write, while no page of a fresh buffer has been touched yet.
+        buffer.reserve(static_cast<size_t>(size));
+        huge_pages::advise(buffer.data(), buffer.capacity());
+        buffer.resize(static_cast<size_t>(size));
+        file.seekg(0);
+        if (!file.read(buffer.data(), size)) {
+            throw std::ios_base::failure("Cannot read input file: " + path);
+        }
+    }
+
+    std::string dayName(int day) {
+        std::ostringstream oss{};
+        oss << "day" << std::setw(2) << std::setfill('0') << day;
+        return oss.str();
+    }
+
+    std::string inputFileName(int day) {
+        return dayName(day) + ".txt";
+    }
+
+    int runDay(int day, int argc, char *argv[]) {
+        if (argc > 2) {
+            std::cout << "Usage: " << argv[0] << " [INPUT_FILE]" << std::endl;
+            return EXIT_FAILURE;
+        }
+        try {
+            const auto &solver = find(day);
+            profiling::calibrateCounter();
+            std::string fileText{};
+            std::string_view text = solver.embeddedInput;
+            if (argc == 2 || text.empty()) {
+                fileText = readInput(argc == 2 ? std::string(argv[1]) : inputFileName(day));
+                text = fileText;
+            }
+            const char *caching = std::getenv("AOC_CACHE");
+            bool useCache = caching != nullptr && std::string_view(caching) == "on" && !profiling::enabled();
+            auto store = useCache ? cache::Store::open() : std::nullopt;
+            auto key = cache::makeKey(solver, 1, text);
+            ParsedInput input{};
+
+            // One write per part, so that the answer of part 1 is out even if part 2 never finishes.
+            logging::BufferedOutput out{};
+            for (int part: {1, 2}) {
+                key.part = part;
+                if (auto cached = store ? store->find(key) : std::nullopt) {
+                    out << *cached << "\n";
+                    out << "[Part " << part << "] Cached answer\n";
+                    out.flush();
+                    continue;
+                }
+                if (!input) {
+                    input = solver.parse(text);
+                }
+
+                Timer timer;
+                allocations::Phase allocationPhase;
+                auto answer = part == 1 ? solver.part1(input) : solver.part2(input);
+                auto elapsed = timer.elapsed();
+                out << answer << "\n";
+                out << "[Part " << part << "] Time elapsed: " << elapsed << " seconds" << allocationPhase << "\n";
+                out.flush();
+                if (store) {
+                    store->save(key, answer);
+                }
+            }
+            if (profiling::enabled()) {
+                out.flush();
+                profiling::report(std::cerr);
+            }
+        } catch (const std::exception &exception) {
+            std::cerr << exception.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+
+}
@@ -0,0 +1,171 @@
+
+#ifndef AOC_2023_SOLVER_H
+#define AOC_2023_SOLVER_H
+
+#include <concepts>
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "arena.h"
+
+#ifdef AOC_EMBEDDED_INPUT
+// Generated for the day's library only, see AOC_EMBED_INPUTS in src/CMakeLists.txt.
+#include "embedded_input.h"
+#endif
+
+/**
+ * Days as a library. Every day implements the Solver concept in its own static library and
+ * registers it here, so that harnesses can run any number of days in one process. The dayNN
+ * executables are thin wrappers around runDay().
+ */
+namespace solver {
+
+    /**
+     * The answer of a part. Puzzles answer with numbers or text, so the answer is kept as text.
+     */
+    struct Answer {
+        std::string value{};
+
+        Answer() = default;
+
+        Answer(std::string text) : value(std::move(text)) {
+        }
+
+        Answer(const char *text) : value(text) {
+        }
+
+        template<typename T>
+        requires std::integral<T> && (!std::same_as<T, char>) && (!std::same_as<T, bool>)
+        Answer(T number) : value(std::to_string(number)) {
+        }
+
+        /**
+         * Sums that outgrow 64 bits, see checked.h.
+         */
+        Answer(__int128 number);
+
+        bool operator==(const Answer &other) const = default;
+    };
+
+    std::ostream &operator<<(std::ostream &out, const Answer &answer);
+
+    /**
+     * A day's solution. Parsing is separated from the parts so that each of them can be timed,
+     * and the parts take the input by const reference so that one parsed input serves both.
+     */
+    template<typename S>
+    concept Solver = requires(std::string_view text, const typename S::Input &input) {
+        { S::parse(text) } -> std::same_as<typename S::Input>;
+        { S::part1(input) } -> std::convertible_to<Answer>;
+        { S::part2(input) } -> std::convertible_to<Answer>;
+    };
+
+    /**
+     * A parsed input of any day.
+     */
+    using ParsedInput = std::shared_ptr<const void>;
+
+    struct DayOptions {
+        // Part 2 does not finish on the puzzle input in reasonable time, harnesses skip it by default.
+        bool slowPart2 = false;
+    };
+
+    struct Day {
+        int day{};
+        DayOptions options;
+        // Changes with the solver's code, see AOC_SOLVER_BUILD_ID. Empty when the build does not set it.
+        std::string buildId;
+        // The puzzle input compiled into the binary, empty unless built with AOC_EMBED_INPUTS.
+        std::string_view embeddedInput;
+        std::function<ParsedInput(std::string_view)> parse;
+        std::function<Answer(const ParsedInput &)> part1;
+        std::function<Answer(const ParsedInput &)> part2;
+    };
+
+    /**
+     * Returns true so that it can initialize a namespace-scope constant in the day's library.
+     * The day libraries are linked as whole archives, otherwise the linker would drop them.
+     */
+    bool add(Day day);
+
+    /**
+     * Registered days ordered by day.
+     */
+    std::vector<Day> days();
+
+    /**
+     * Throws std::invalid_argument when the day is not linked in.
+     */
+    const Day &find(int day);
+
+    /**
+     * AOC_SOLVER_BUILD_ID is defined by the build of every day's library, see src/CMakeLists.txt.
+     * Every stage runs in its own scratch arena (see arena.h), as the parts may run concurrently.
+     */
+    template<Solver S>
+    bool registerSolver(int day, DayOptions options = {}) {
+        using Input = typename S::Input;
+
+        return add(Day{
+                .day = day,
+                .options = options,
+#ifdef AOC_SOLVER_BUILD_ID
+                .buildId = AOC_SOLVER_BUILD_ID,
+#endif
+#ifdef AOC_EMBEDDED_INPUT
+                .embeddedInput = embedded::INPUT,
+#else
+                .embeddedInput = {},
+#endif
+                .parse = [](std::string_view text) -> ParsedInput {
+                    arena::Scope scratch{};
+                    return std::make_shared<const Input>(S::parse(text));
+                },
+                .part1 = [](const ParsedInput &input) {
+                    arena::Scope scratch{};
+                    return Answer(S::part1(*static_cast<const Input *>(input.get())));
+                },
+                .part2 = [](const ParsedInput &input) {
+                    arena::Scope scratch{};
+                    return Answer(S::part2(*static_cast<const Input *>(input.get())));
+                }});
+    }
+
+    /**
+     * Reads a whole input file. Throws std::ios_base::failure when it cannot be opened.
+     */
+    std::string readInput(const std::string &path);
+
+    /**
+     * Reads a whole input file into the buffer, reusing its capacity.
+     */
+    void readInput(const std::string &path, std::string &buffer);
+
+    /**
+     * "day05" for day 5.
+     */
+    std::string dayName(int day);
+
+    /**
+     * "day05.txt" for day 5.
+     */
+    std::string inputFileName(int day);
+
+    /**
+     * The main() of a day's executable: solves the input given as the only argument, or else the
+     * embedded input or dayNN.txt in the working directory, and prints the answers with the time
+     * each part took.
+     * Timing the parts is the point, so the cache (see cache.h) is only used with AOC_CACHE=on,
+     * and then answers found in it are printed without solving. With profiling on (see
+     * profiling.h), the parts are always solved and the zone totals follow on stderr.
+     */
+    int runDay(int day, int argc, char *argv[]);
+
+}
+
+#endif
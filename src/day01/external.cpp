@@ -0,0 +1,185 @@
+#include "external.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "checked.h"
+#include "external_sort.h"
+#include "logging.h"
+#include "profiling.h"
+#include "solver.h"
+#include "timer.h"
+
+
+namespace day01::external {
+
+    using Sorter = external_sort::Sorter<int32_t>;
+    using Merger = external_sort::Merger<int32_t>;
+
+    constexpr size_t MIN_BUDGET = 1024;
+
+    /**
+     * The input is read a block at a time. The block is part of the budget while the runs are built.
+     */
+    size_t blockSize(size_t budgetBytes) {
+        return std::clamp<size_t>(budgetBytes / 8, 128, 1024 * 1024);
+    }
+
+    const char *skipBlanks(const char *begin, const char *end) {
+        while (begin != end && (*begin == ' ' || *begin == '\t' || *begin == '\r')) {
+            begin++;
+        }
+        return begin;
+    }
+
+    /**
+     * Pushes the two numbers of the line, blank lines are skipped.
+     */
+    void parseLine(std::string_view line, Sorter &first, Sorter &second) {
+        const char *end = line.data() + line.size();
+        const char *position = skipBlanks(line.data(), end);
+        if (position == end) {
+            return;
+        }
+        int32_t numbers[2];
+        for (auto &number: numbers) {
+            auto [next, error] = std::from_chars(skipBlanks(position, end), end, number);
+            if (error != std::errc{}) {
+                throw std::invalid_argument("day01: Invalid line " + std::string(line));
+            }
+            position = next;
+        }
+        first.push(numbers[0]);
+        second.push(numbers[1]);
+    }
+
+    void readLists(const std::string &path, size_t blockBytes, Sorter &first, Sorter &second) {
+        AOC_PROFILE_ZONE("day01 external runs");
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            throw std::ios_base::failure("Cannot open input file: " + path);
+        }
+        std::vector<char> block(blockBytes);
+        size_t carried = 0;
+        while (file) {
+            file.read(block.data() + carried, static_cast<std::streamsize>(block.size() - carried));
+            auto size = carried + static_cast<size_t>(file.gcount());
+            std::string_view text(block.data(), size);
+            // The last line of the file may have no newline, the last line of a block may go on.
+            auto complete = file ? text.rfind('\n') + 1 : size;
+            if (complete == 0 && size == block.size()) {
+                throw std::invalid_argument("day01: Line longer than the read block");
+            }
+            for (size_t start = 0; start < complete;) {
+                auto newline = text.find('\n', start);
+                auto lineEnd = newline < complete ? newline : complete;
+                parseLine(text.substr(start, lineEnd - start), first, second);
+                start = lineEnd + 1;
+            }
+            carried = size - complete;
+            std::memmove(block.data(), block.data() + complete, carried);
+        }
+        first.finish();
+        second.finish();
+    }
+
+    /**
+     * Part 1 pairs the lists index by index in sorted order.
+     */
+    checked::Wide totalDistance(Merger first, Merger second) {
+        AOC_PROFILE_ZONE("day01 external part 1");
+        checked::Accumulator sum{};
+        int32_t a;
+        int32_t b;
+        while (first.next(a)) {
+            if (!second.next(b)) {
+                throw std::invalid_argument("day01: The lists differ in length");
+            }
+            sum.add(std::abs(static_cast<int64_t>(a) - b));
+        }
+        if (second.next(b)) {
+            throw std::invalid_argument("day01: The lists differ in length");
+        }
+        return sum.total();
+    }
+
+    /**
+     * Part 2 joins the sorted lists on equal numbers, a number in the first list scores itself times
+     * its count in the second.
+     */
+    checked::Wide similarityScore(Merger first, Merger second) {
+        AOC_PROFILE_ZONE("day01 external part 2");
+        checked::Accumulator sum{};
+        int32_t a;
+        int32_t b;
+        bool hasA = first.next(a);
+        bool hasB = second.next(b);
+        while (hasA && hasB) {
+            if (a < b) {
+                hasA = first.next(a);
+            } else if (b < a) {
+                hasB = second.next(b);
+            } else {
+                auto number = a;
+                int64_t firstCount = 0;
+                int64_t secondCount = 0;
+                for (; hasA && a == number; hasA = first.next(a)) {
+                    firstCount++;
+                }
+                for (; hasB && b == number; hasB = second.next(b)) {
+                    secondCount++;
+                }
+                auto pairs = checked::mul<checked::Wide>(firstCount, secondCount);
+                sum.addWide(checked::mul<checked::Wide>(number, pairs));
+            }
+        }
+        return sum.total();
+    }
+
+    int run(int argc, char *argv[], size_t budgetBytes) {
+        if (argc > 2) {
+            std::cout << "Usage: " << argv[0] << " [INPUT_FILE]" << std::endl;
+            return EXIT_FAILURE;
+        }
+        try {
+            if (budgetBytes < MIN_BUDGET) {
+                throw std::invalid_argument("day01: AOC_SORT_BUDGET below 1K");
+            }
+            auto path = argc == 2 ? std::string(argv[1]) : solver::inputFileName(1);
+            // While the runs are built, the block shares the budget with the two sort buffers.
+            auto blockBytes = blockSize(budgetBytes);
+            Sorter first((budgetBytes - blockBytes) / 2);
+            Sorter second((budgetBytes - blockBytes) / 2);
+            readLists(path, blockBytes, first, second);
+            AOC_LOG_INFO("day01: " << first.size() << " pairs in " << first.runCount() << " + "
+                                   << second.runCount() << " runs within " << budgetBytes << " bytes");
+
+            logging::BufferedOutput out{};
+            for (int part: {1, 2}) {
+                Timer timer;
+                auto answer = part == 1 ? totalDistance(first.sorted(), second.sorted())
+                                        : similarityScore(first.sorted(), second.sorted());
+                auto elapsed = timer.elapsed();
+                out << solver::Answer(answer) << "\n";
+                out << "[Part " << part << "] Time elapsed: " << elapsed << " seconds\n";
+                out.flush();
+            }
+            if (profiling::enabled()) {
+                profiling::report(std::cerr);
+            }
+        } catch (const std::exception &exception) {
+            std::cerr << exception.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+
+}
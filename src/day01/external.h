@@ -0,0 +1,21 @@
+
+#ifndef AOC_2023_DAY01_EXTERNAL_H
+#define AOC_2023_DAY01_EXTERNAL_H
+
+#include <cstddef>
+
+/**
+ * Day 1 for lists larger than memory. The lists are streamed from the input file into external
+ * sorters (see external_sort.h), and both parts walk the two sorted lists in lockstep, so that
+ * memory stays within the budget however long the lists are.
+ */
+namespace day01::external {
+
+    /**
+     * Solves the input file of the arguments, as solver::runDay() does, within `budgetBytes`.
+     */
+    int run(int argc, char *argv[], size_t budgetBytes);
+
+}
+
+#endif
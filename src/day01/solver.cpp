@@ -0,0 +1,119 @@
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include <numeric>
+#include <string_view>
+#include <unordered_map>
+#include "checked.h"
+#include "input.h"
+#include "simd.h"
+#include "solver.h"
+
+
+namespace day01 {
+    struct Input {
+        explicit Input(std::size_t size) {
+            firstList.reserve(size);
+            secondList.reserve(size);
+        }
+
+        std::vector<int> firstList;
+        std::vector<int> secondList;
+    };
+
+    Input parseInput(std::string_view text) {
+        auto lines = input::splitLines(text);
+
+        Input input(lines.size());
+
+        int firstNumber;
+        int secondNumber;
+
+        for (const auto &line: lines) {
+            std::istringstream iss(line);
+            iss >> firstNumber >> secondNumber;
+
+            input.firstList.push_back(firstNumber);
+            input.secondList.push_back(secondNumber);
+        }
+        return input;
+    }
+
+}
+
+namespace day01::part1 {
+
+    void sortList(std::vector<int> &list) {
+        std::sort(list.begin(), list.end());
+    }
+
+    /**
+     * The distance of two ints needs 32 unsigned bits, so the distances are 64-bit.
+     */
+    std::vector<int64_t> compareItems(const std::vector<int> &firstList, const std::vector<int> &secondList) {
+        std::vector<int64_t> result(firstList.size());
+        std::transform(firstList.begin(), firstList.end(),
+                       secondList.begin(), result.begin(),
+                       [](int a, int b) { return std::abs(static_cast<int64_t>(a) - b); });
+        return result;
+    }
+
+    checked::Wide execute(const Input &input) {
+        auto firstList = input.firstList;
+        auto secondList = input.secondList;
+        sortList(firstList);
+        sortList(secondList);
+
+        auto result = compareItems(firstList, secondList);
+
+        return simd::sum(result);
+    }
+}
+
+namespace day01::part2 {
+
+    std::vector<int64_t> computeSimilarityScores(const std::vector<int> &list, std::unordered_map<int, int> &counts) {
+        std::vector<int64_t> result{};
+        result.reserve(list.size());
+
+        for (const auto &item: list) {
+            int64_t similarityScore = static_cast<int64_t>(item) * counts[item];
+            result.push_back(similarityScore);
+        }
+        return result;
+    }
+
+    checked::Wide execute(const Input &input) {
+        std::unordered_map<int, int> counts;
+        for (const auto &item: input.secondList) {
+            counts[item] += 1;
+        }
+
+        std::vector<int64_t> similarityScores = computeSimilarityScores(input.firstList, counts);
+
+        return simd::sum(similarityScores);
+    }
+}
+
+namespace day01 {
+    struct Solver {
+        using Input = day01::Input;
+
+        static Input parse(std::string_view text) {
+            return parseInput(text);
+        }
+
+        static solver::Answer part1(const Input &input) {
+            return day01::part1::execute(input);
+        }
+
+        static solver::Answer part2(const Input &input) {
+            return day01::part2::execute(input);
+        }
+    };
+
+    const bool registered = solver::registerSolver<Solver>(1);
+}
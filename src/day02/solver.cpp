@@ -0,0 +1,186 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <span>
+#include <string_view>
+#include "arena.h"
+#include "input.h"
+#include "jagged.h"
+#include "scheduler.h"
+#include "small_vector.h"
+#include "solver.h"
+
+namespace day02 {
+
+    /**
+     * A report's levels, viewed in the input or in a copy with a level removed.
+     */
+    struct Report {
+        std::span<const int> levels;
+
+        Report(std::span<const int> reportLevels) : levels(reportLevels) {
+        }
+
+        friend std::ostream &operator<<(std::ostream &out, const Report &report) {
+            out << "[";
+            for (size_t i = 0; i < report.levels.size(); i++) {
+                out << report.levels[i];
+                if (i < report.levels.size() - 1) {
+                    out << ",";
+                }
+            }
+            out << "]\n";
+            return out;
+        }
+    };
+
+    struct Input {
+        // The levels of all reports in one array.
+        Jagged<int> reports;
+
+        friend std::ostream &operator<<(std::ostream &out, const Input &input) {
+            out << "[";
+            for (size_t i = 0; i < input.reports.size(); i++) {
+                out << Report(input.reports[i]);
+                if (i < input.reports.size() - 1) {
+                    out << ",";
+                }
+            }
+            out << "]";
+            return out;
+        }
+    };
+
+    Input parseInput(std::string_view text) {
+        auto lines = input::splitLines(text, arena::current());
+        Input input{};
+        input.reports = buildJagged<int>(lines.size(), [&lines](size_t i, std::vector<int> &levels) {
+            input::parseInto<int>(lines[i], ' ', levels);
+        });
+        return input;
+    }
+
+    int evaluatePredicate(int stride, const Report &report,
+                          const std::function<bool(int currentLevel, int nextLevel)>& predicate) {
+        const auto &levels = report.levels;
+
+        for (size_t i = 0; i < levels.size() - stride; i += stride) {
+            bool conditionFailed = !predicate(levels[i], levels[i + stride]);
+            if (conditionFailed) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool isIncreasingOrDecreasing(int stride, const Report &report) {
+        auto isIncreasingPredicate = [](int currentLevel, int nextLevel) {
+            return currentLevel < nextLevel;
+        };
+
+        auto isDecreasingPredicate = [](int currentLevel, int nextLevel) {
+            return currentLevel > nextLevel;
+        };
+
+        bool isIncreasing = evaluatePredicate(stride, report, isIncreasingPredicate);
+        bool isDecreasing = evaluatePredicate(stride, report, isDecreasingPredicate);
+
+        return isIncreasing || isDecreasing;
+    }
+
+    bool isDifferenceWithinBounds(int stride, int min, int max, const Report &report) {
+        auto predicate = [min, max](int currentLevel, int nextLevel) {
+            int diff = std::abs(nextLevel - currentLevel);
+            return diff >= min && diff <= max;
+        };
+
+        bool isWithinBounds = evaluatePredicate(stride, report, predicate);
+        return isWithinBounds;
+    }
+
+    bool evaluateRules(const Report &report) {
+        int stride = 1;
+        int minDifference = 1;
+        int maxDifference = 3;
+
+        auto rule1 = [&]() {
+            return isIncreasingOrDecreasing(stride, report);
+        };
+        auto rule2 = [&]() {
+            return isDifferenceWithinBounds(stride, minDifference, maxDifference, report);
+        };
+
+        std::vector<std::function<bool()>> rules = {rule1, rule2};
+
+        bool result = std::all_of(rules.begin(), rules.end(), [](const std::function<bool()> &rule) {
+            return rule();
+        });
+        return result;
+    }
+
+}
+
+namespace day02::part1 {
+
+    bool isReportSafe(const Report &report) {
+        bool result = evaluateRules(report);
+        return result;
+    }
+
+    long execute(const Input &input) {
+        return std::count_if(input.reports.begin(), input.reports.end(), isReportSafe);
+    }
+}
+
+namespace day02::part2 {
+
+    bool isReportSafe(const Report &report) {
+        bool result = evaluateRules(report);
+        if (result) {
+            return true;
+        }
+        // Evaluate report without a level
+        for (size_t i = 0; i < report.levels.size(); i++) {
+            // Reports are short, see the generator and the puzzle input.
+            SmallVector<int, 16> levelsWithoutSingleLevel(report.levels.begin(), report.levels.end());
+            levelsWithoutSingleLevel.erase(levelsWithoutSingleLevel.begin() + i);
+
+            result = evaluateRules(Report(levelsWithoutSingleLevel));
+            if (result) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    long execute(const Input &input) {
+        // Checking a report copies it once per level, which is worth spreading over workers in chunks.
+        const auto &reports = input.reports;
+        auto numSafe = scheduler::parallelCount(size_t{0}, reports.size(), [&reports](size_t i) {
+            return isReportSafe(reports[i]);
+        }, 64);
+        return static_cast<long>(numSafe);
+    }
+}
+
+namespace day02 {
+    struct Solver {
+        using Input = day02::Input;
+
+        static Input parse(std::string_view text) {
+            return parseInput(text);
+        }
+
+        static solver::Answer part1(const Input &input) {
+            return day02::part1::execute(input);
+        }
+
+        static solver::Answer part2(const Input &input) {
+            return day02::part2::execute(input);
+        }
+    };
+
+    const bool registered = solver::registerSolver<Solver>(2);
+}
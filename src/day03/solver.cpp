@@ -0,0 +1,177 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <numeric>
+#include <optional>
+#include <charconv>
+#include <regex>
+#include <string_view>
+#include "checked.h"
+#include "input.h"
+#include "solver.h"
+
+namespace day03 {
+
+    using Input = std::string;
+
+    Input parseInput(std::string_view text) {
+        return Input(text);
+    }
+
+    struct MulInstruction {
+        int64_t firstNumber;
+        int64_t secondNumber;
+
+        friend std::ostream &operator<<(std::ostream &out, const MulInstruction &instr) {
+            out << "(" << instr.firstNumber << "," << instr.secondNumber << ")";
+            return out;
+        }
+    };
+
+    class Parser {
+    public:
+        std::vector<std::pair<MulInstruction, int>> extractValidInstructions(const std::string &inputString) {
+            std::vector<std::pair<MulInstruction, int>> instructions;
+            std::regex pattern(R"(mul\((\d+),(\d+)\))");
+            std::sregex_iterator it(inputString.begin(), inputString.end(), pattern);
+            std::sregex_iterator end;
+
+            for (; it != end; ++it) {
+                auto position = static_cast<int>(it->position());
+
+                MulInstruction instruction{
+                        std::stoll(it->str(1)),
+                        std::stoll(it->str(2))
+                };
+                instructions.emplace_back(instruction, position);
+            }
+            return instructions;
+        }
+
+        std::vector<int> extractPositionsOfDoInstructions(const std::string &inputString) {
+            std::vector<int> positions;
+            std::regex pattern(R"(do\(\))");
+            std::sregex_iterator it(inputString.begin(), inputString.end(), pattern);
+            std::sregex_iterator end;
+
+            for (; it != end; ++it) {
+                auto position = static_cast<int>(it->position());
+                positions.push_back(position);
+            }
+            return positions;
+        }
+
+        std::vector<int> extractPositionsOfDontInstructions(const std::string &inputString) {
+            std::vector<int> positions;
+            std::regex pattern(R"(don't\(\))");
+            std::sregex_iterator it(inputString.begin(), inputString.end(), pattern);
+            std::sregex_iterator end;
+
+            for (; it != end; ++it) {
+                auto position = static_cast<int>(it->position());
+                positions.push_back(position);
+            }
+            return positions;
+        }
+    };
+}
+
+namespace day03::part1 {
+
+
+    /**
+     * Products of 64-bit operands, and their sums, need up to 128 bits.
+     */
+    checked::Wide sumInstructionResults(const std::vector<std::pair<MulInstruction, int>> &instructions) {
+        checked::Accumulator sum{};
+        for (const auto &[instruction, position]: instructions) {
+            sum.addProduct(instruction.firstNumber, instruction.secondNumber);
+        }
+        return sum.total();
+    }
+
+    checked::Wide execute(const Input &input) {
+        Parser parser{};
+        auto instructions = parser.extractValidInstructions(input);
+
+        return sumInstructionResults(instructions);
+    }
+}
+
+namespace day03::part2 {
+
+    std::vector<MulInstruction> extractEnabledInstructions(
+            const std::vector<std::pair<MulInstruction, int>> &instructions,
+            const std::vector<int> &doPositions,
+            const std::vector<int> &dontPositions) {
+
+        std::vector<MulInstruction> enabledInstructions;
+
+        bool enabled = true;
+        auto doPositionsIter = doPositions.begin();
+        auto dontPositionsIter = dontPositions.begin();
+
+        int lastProcessedPosition = -1;
+
+        for (const auto &[instruction, position]: instructions) {
+            while (*doPositionsIter < position && doPositionsIter != doPositions.end()) {
+                if (*doPositionsIter > lastProcessedPosition) {
+                    enabled = true;
+                    lastProcessedPosition = *doPositionsIter;
+                }
+                doPositionsIter++;
+            }
+            while (*dontPositionsIter < position && dontPositionsIter != dontPositions.end()) {
+                if (*dontPositionsIter > lastProcessedPosition) {
+                    enabled = false;
+                    lastProcessedPosition = *dontPositionsIter;
+                }
+                dontPositionsIter++;
+            }
+            if (enabled) {
+                enabledInstructions.push_back(instruction);
+            }
+        }
+        return enabledInstructions;
+    }
+
+    checked::Wide sumInstructionResults(const std::vector<MulInstruction> &instructions) {
+        checked::Accumulator sum{};
+        for (const auto &instruction: instructions) {
+            sum.addProduct(instruction.firstNumber, instruction.secondNumber);
+        }
+        return sum.total();
+    }
+
+    checked::Wide execute(const Input &input) {
+        Parser parser{};
+        auto instructions = parser.extractValidInstructions(input);
+        auto doInstructionPositions = parser.extractPositionsOfDoInstructions(input);
+        auto dontInstructionPositions = parser.extractPositionsOfDontInstructions(input);
+
+        auto enabledInstructions = extractEnabledInstructions(instructions, doInstructionPositions,
+                                                              dontInstructionPositions);
+
+        return sumInstructionResults(enabledInstructions);
+    }
+}
+
+namespace day03 {
+    struct Solver {
+        using Input = day03::Input;
+
+        static Input parse(std::string_view text) {
+            return parseInput(text);
+        }
+
+        static solver::Answer part1(const Input &input) {
+            return day03::part1::execute(input);
+        }
+
+        static solver::Answer part2(const Input &input) {
+            return day03::part2::execute(input);
+        }
+    };
+
+    const bool registered = solver::registerSolver<Solver>(3);
+}
@@ -0,0 +1,282 @@
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include <numeric>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+#include "arena.h"
+#include "differential.h"
+#include "input.h"
+#include "jagged.h"
+#include "scheduler.h"
+#include "small_vector.h"
+#include "solver.h"
+
+namespace day05 {
+
+    // A copy of an update to reorder, updates list a few dozen pages at most.
+    using Update = SmallVector<int, 24>;
+    using Rule = std::pair<int, int>;
+
+    struct Input {
+        std::vector<Rule> rules;
+        // The pages of all updates in one array.
+        Jagged<int> updates;
+    };
+
+    /**
+     * Whether a rule puts one page before another, as a table over the page numbers.
+     */
+    class PageOrder {
+    public:
+        explicit PageOrder(const std::vector<Rule> &rules) {
+            for (const auto &[before, after]: rules) {
+                m_pages = std::max({m_pages, before + 1, after + 1});
+            }
+            m_before.resize(static_cast<size_t>(m_pages) * m_pages);
+            for (const auto &[before, after]: rules) {
+                m_before[static_cast<size_t>(before) * m_pages + after] = true;
+            }
+        }
+
+        bool operator()(int left, int right) const {
+            if (left < 0 || right < 0 || left >= m_pages || right >= m_pages) {
+                return false;
+            }
+            return m_before[static_cast<size_t>(left) * m_pages + right];
+        }
+
+    private:
+        int m_pages = 0;
+        std::vector<bool> m_before{};
+    };
+
+    // Pages are two-digit numbers, which also bounds the table of PageOrder.
+    constexpr int PAGE_LIMIT = 100;
+
+    int checkPage(int page) {
+        if (page < 0 || page >= PAGE_LIMIT) {
+            throw std::invalid_argument("day05: Page out of range: " + std::to_string(page));
+        }
+        return page;
+    }
+
+    /**
+     * Throws std::invalid_argument unless the rules order the pages of the update totally, as the
+     * puzzle promises. Otherwise reorderUpdate() would not terminate and sorting by PageOrder
+     * would be undefined. Every pair must be ordered one way, and the pages must precede distinct
+     * numbers of other pages, which rules out cycles.
+     */
+    void checkTotallyOrdered(std::span<const int> update, const PageOrder &order) {
+        if (update.empty()) {
+            throw std::invalid_argument("day05: Empty update");
+        }
+        SmallVector<int, 24> precedes(update.size(), 0);
+        for (size_t i = 0; i < update.size(); i++) {
+            for (size_t j = i + 1; j < update.size(); j++) {
+                bool before = order(update[i], update[j]);
+                if (before == order(update[j], update[i])) {
+                    throw std::invalid_argument("day05: Rules do not order pages " + std::to_string(update[i]) +
+                                                " and " + std::to_string(update[j]));
+                }
+                precedes[before ? i : j]++;
+            }
+        }
+        std::sort(precedes.begin(), precedes.end());
+        if (std::adjacent_find(precedes.begin(), precedes.end()) != precedes.end()) {
+            throw std::invalid_argument("day05: Rules order an update cyclically");
+        }
+    }
+
+    Input parseInput(std::string_view text) {
+        Input input{};
+        // The lines and numbers are scratch, only the rules and updates are kept.
+        auto *scratch = arena::current();
+        auto parts = input::split(text, "\n\n", input::Blanks::Remove, scratch);
+        if (parts.size() != 2) {
+            throw std::invalid_argument("day05: Expected rules and updates");
+        }
+        const auto &rulesPart = parts[0];
+        const auto &updatesPart = parts[1];
+
+        auto rulesLines = input::split(rulesPart, '\n', input::Blanks::Allow, scratch);
+        for (const auto &line : rulesLines) {
+            auto rule = input::parseVector<int>(line, '|', scratch);
+            if (rule.size() != 2 || rule[0] == rule[1]) {
+                throw std::invalid_argument("day05: Invalid rule " + std::string(line));
+            }
+            input.rules.emplace_back(checkPage(rule[0]), checkPage(rule[1]));
+        }
+
+        auto updatesLines = input::split(updatesPart, '\n', input::Blanks::Allow, scratch);
+        input.updates = buildJagged<int>(updatesLines.size(), [&updatesLines](size_t i, std::vector<int> &pages) {
+            input::parseInto<int>(updatesLines[i], ',', pages);
+            std::for_each(pages.begin(), pages.end(), checkPage);
+        });
+
+        PageOrder order(input.rules);
+        for (auto update: input.updates) {
+            checkTotallyOrdered(update, order);
+        }
+
+        return input;
+    }
+
+    using RuleMap = std::unordered_map<int, std::vector<Rule>>;
+
+    RuleMap formRuleMap(const std::vector<Rule> &rules) {
+        // I need to form a std::unordered_map<int, std::vector<Rule>> containing the rules grouped by the right side of the rule
+        RuleMap map{};
+        for (const auto &rule: rules) {
+            map[rule.second].push_back(rule);
+        }
+        return map;
+    }
+
+    /**
+     * Rules with the number on the right side. The map is only read, so updates can be checked concurrently.
+     */
+    const std::vector<Rule> &findMatchingRules(int number, const RuleMap &ruleMap) {
+        static const std::vector<Rule> noRules{};
+        auto it = ruleMap.find(number);
+        return it != ruleMap.end() ? it->second : noRules;
+    }
+
+    bool existsRuleForThatNumber(int number, const std::vector<Rule> &matchingRules) {
+        auto ruleMatchesNumber = [number](const Rule &rule) {
+            return rule.first == number;
+        };
+        return std::any_of(matchingRules.begin(), matchingRules.end(), ruleMatchesNumber);
+    }
+
+    bool isUpdateValid(std::span<const int> update, const RuleMap &ruleMap) {
+        // I will go through the update numbers one by one
+        for (int currentNumberId = 0; currentNumberId < update.size(); currentNumberId++) {
+            int number = update[currentNumberId];
+            const auto &matchingRules = findMatchingRules(number, ruleMap);
+            // And check that for each number on the left exists a rule
+            for (int leftOfCurrentId = 0; leftOfCurrentId < currentNumberId; leftOfCurrentId++) {
+                int leftOfNumber = update[leftOfCurrentId];
+                bool ruleExists = existsRuleForThatNumber(leftOfNumber, matchingRules);
+                if (!ruleExists) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    int getMiddleValue(std::span<const int> update) {
+        int size = static_cast<int>(update.size());
+        int index = size / 2; // Assumption is that there is an odd count of numbers.
+        return update[index];
+    }
+
+}
+
+namespace day05::part1 {
+
+    int execute(const Input &input) {
+        auto ruleMap = formRuleMap(input.rules);
+
+        int sumOfMiddleValues = 0;
+        for (auto update: input.updates) {
+            bool isValid = isUpdateValid(update, ruleMap);
+            if (isValid) {
+                sumOfMiddleValues += getMiddleValue(update);
+            }
+
+        }
+        return sumOfMiddleValues;
+    }
+}
+
+namespace day05::part2 {
+
+    Update reorderUpdate(Update &update, const RuleMap &ruleMap) {
+        for (int currentNumberId = 0; currentNumberId < update.size(); currentNumberId++) {
+            int number = update[currentNumberId];
+            const auto &matchingRules = findMatchingRules(number, ruleMap);
+
+            // Check all numbers to the left of the current number
+            for (int leftOfCurrentId = 0; leftOfCurrentId < currentNumberId; leftOfCurrentId++) {
+                int leftOfNumber = update[leftOfCurrentId];
+
+                if (!existsRuleForThatNumber(leftOfNumber, matchingRules)) {
+                    // Swap the two numbers
+                    std::swap(update[leftOfCurrentId], update[currentNumberId]);
+                    // Recursively keep swapping numbers that do not form a match
+                    return reorderUpdate(update, ruleMap);
+                }
+            }
+        }
+        return update;
+    }
+
+    /**
+     * The rules order every pair of pages of an update, so sorting by them arrives at the order
+     * reorderUpdate() finds by swapping, in O(n log n) lookups of a table instead of the restarts.
+     */
+    void sortUpdate(Update &update, const PageOrder &order) {
+        std::sort(update.begin(), update.end(), order);
+    }
+
+    int execute(const Input &input) {
+        PageOrder order(input.rules);
+
+        // Reordering works in place, so every invalid update is a copy.
+        return scheduler::parallelReduce(size_t{0}, input.updates.size(), 0, [&](size_t i) {
+            auto update = input.updates[i];
+            if (std::is_sorted(update.begin(), update.end(), order)) {
+                return 0;
+            }
+            Update sortedUpdate(update.begin(), update.end());
+            sortUpdate(sortedUpdate, order);
+            return getMiddleValue(sortedUpdate);
+        }, std::plus<int>());
+    }
+
+    /**
+     * The oracle of execute(), see differential.h.
+     */
+    int executeReference(const Input &input) {
+        auto ruleMap = formRuleMap(input.rules);
+
+        return scheduler::parallelReduce(size_t{0}, input.updates.size(), 0, [&](size_t i) {
+            auto update = input.updates[i];
+            if (isUpdateValid(update, ruleMap)) {
+                return 0;
+            }
+            Update reorderedUpdate(update.begin(), update.end());
+            reorderedUpdate = reorderUpdate(reorderedUpdate, ruleMap);
+            return getMiddleValue(reorderedUpdate);
+        }, std::plus<int>());
+    }
+}
+
+namespace day05 {
+    struct Solver {
+        using Input = day05::Input;
+
+        static Input parse(std::string_view text) {
+            return parseInput(text);
+        }
+
+        static solver::Answer part1(const Input &input) {
+            return day05::part1::execute(input);
+        }
+
+        static solver::Answer part2(const Input &input) {
+            return day05::part2::execute(input);
+        }
+    };
+
+    const bool registered = solver::registerSolver<Solver>(5);
+
+    const bool checked = differential::registerCheck<Solver>(5, 2, "reorderUpdate", part2::executeReference,
+                                                             part2::execute);
+}
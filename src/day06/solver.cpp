@@ -0,0 +1,280 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include <optional>
+#include <unordered_set>
+#include <string_view>
+#include <unordered_map>
+#include "input.h"
+#include "logging.h"
+#include "print.h"
+#include "scheduler.h"
+#include "solver.h"
+#include "array2d.h"
+#include "Coord.h"
+#include "Direction.h"
+
+
+namespace day06 {
+
+    enum FieldType {
+        Empty,
+        Obstruction,
+        Guard
+    };
+
+    std::unordered_map<char, FieldType> charToFieldTypeMap{
+            {'.', Empty},
+            {'#', Obstruction},
+            {'^', Guard}};
+
+    std::unordered_map<FieldType, char> fieldTypeToCharMap{
+            {Empty,       '.'},
+            {Obstruction, '#'},
+            {Guard,       '^'}};
+
+
+    std::ostream &operator<<(std::ostream &out, const FieldType &data) {
+        out << fieldTypeToCharMap.at(data);
+        return out;
+    }
+
+    // Guards walk large maps in long strides, see huge_pages.h.
+    using Map = HugeArray2D<FieldType>;
+
+    FieldType transformCharToFieldType(char character) {
+        return charToFieldTypeMap.at(character);
+    }
+
+    Map parseInput(std::string_view text) {
+        auto lines = input::splitLines(text);
+        std::function<FieldType(char)> transformFunction = transformCharToFieldType;
+        return input::load2D<FieldType, Map::allocator_type>(lines, transformFunction);
+    }
+
+    Coord findGuardPosition(const Map &map) {
+        auto it = std::find(map.cbegin(), map.cend(), FieldType::Guard);
+        if (it != map.cend()) {
+            size_t index = std::distance(map.cbegin(), it);
+
+            int row = static_cast<int>(index) / map.cols();
+            int col = static_cast<int>(index) % map.cols();
+
+            return Coord{.col=col, .row=row};
+        }
+        throw std::runtime_error("No guard was found.");
+    }
+}
+
+namespace day06::part1 {
+
+    struct CoordDirectionHash {
+        std::size_t operator( )(const std::pair<Coord, Direction> &p) const {
+            CoordHash coordHash;
+            auto h1 = coordHash(p.first);
+            auto h2 = std::hash<Direction>{}(p.second);
+            return h1 * 31 + h2;
+        }
+    };
+
+    class Guard {
+    public:
+        explicit Guard(Coord position)
+                : position(position),
+                  direction(Direction::Up) {}
+
+
+        int walk(const Map &map) {
+            while (map.isInBounds(position.row, position.col)) {
+                determineNextDirection(map);
+                move();
+
+                if (map.isInBounds(position.row, position.col)) {
+                    markPosition();
+                }
+            }
+
+            return static_cast<int>(visitedCoords.size());
+        }
+
+        std::unordered_set<Coord, CoordHash> getVisitedCoords() const {
+            return visitedCoords;
+        }
+
+        bool walkDetectLoop(const Map &map) {
+            Coord startPosition = position;
+            std::unordered_set<std::pair<Coord, Direction>, CoordDirectionHash> visitedBefore;
+            visitedBefore.insert({startPosition, direction});
+
+            while (map.isInBounds(position.row, position.col)) {
+                determineNextDirection(map);
+                move();
+
+                if (map.isInBounds(position.row, position.col)) {
+                    if (visitedBefore.count({position, direction}) > 0) {
+                        return true;
+                    }
+
+                    visitedBefore.insert({position, direction});
+                }
+            }
+
+            return false;
+        }
+
+    private:
+
+        /**
+         * Looks if there is an obstacle directly in front of it and rotates if there is.
+         * It keeps rotating until there is an empty tile in front of it.
+         */
+        void determineNextDirection(const Map &map) {
+            while (isObstructionInFront(map)) {
+                changeDirection();
+            }
+        }
+
+        bool isObstructionInFront(const Map &map) {
+            auto nextCoord = getNextCoordInCurrentDirection();
+            if (map.isInBounds(nextCoord.row, nextCoord.col)) {
+                return map(nextCoord.row, nextCoord.col) == FieldType::Obstruction;
+            }
+            return false;
+        }
+
+        void changeDirection() {
+            switch (direction) {
+                case Direction::Up:
+                    direction = Direction::Right;
+                    break;
+                case Direction::Down:
+                    direction = Direction::Left;
+                    break;
+                case Direction::Left:
+                    direction = Direction::Up;
+                    break;
+                case Direction::Right:
+                    direction = Direction::Down;
+                    break;
+                default:
+                    throw std::invalid_argument("Invalid direction");
+            }
+        }
+
+        Coord getNextCoordInCurrentDirection() {
+            switch (direction) {
+                case Direction::Up:
+                    return position.getUpCoord();
+                case Direction::Down:
+                    return position.getDownCoord();
+                case Direction::Left:
+                    return position.getLeftCoord();
+                case Direction::Right:
+                    return position.getRightCoord();
+                default:
+                    throw std::invalid_argument("Invalid direction");
+            }
+
+        }
+
+        /**
+         * Moves guard in its currently set direction. Assumes no obstacle in front of it.
+         */
+        void move() {
+            switch (direction) {
+                case Direction::Up:
+                    position = position.getUpCoord();
+                    break;
+                case Direction::Down:
+                    position = position.getDownCoord();
+                    break;
+                case Direction::Left:
+                    position = position.getLeftCoord();
+                    break;
+                case Direction::Right:
+                    position = position.getRightCoord();
+                    break;
+                default:
+                    throw std::invalid_argument("Invalid direction");
+            }
+        }
+
+        void markPosition() {
+            visitedCoords.insert(position);
+        }
+
+        Coord position;
+        Direction direction;
+        std::unordered_set<Coord, CoordHash> visitedCoords;
+    };
+
+    int execute(const Map &map) {
+        AOC_LOG_DEBUG('\n' << renderGrid(map));
+
+        auto guardPosition = findGuardPosition(map);
+        Guard guard(guardPosition);
+        return guard.walk(map);
+    }
+}
+
+namespace day06::part2 {
+
+    using Guard = part1::Guard;
+
+    bool placeObstacleAndDetectLoop(const Coord &startingPosition, const Coord &coord, Map &map) {
+        // Cannot place an obstruction where the guard is standing.
+        if (startingPosition == coord) {
+            return false;
+        }
+
+        map(coord.row, coord.col) = FieldType::Obstruction;
+
+        Guard guard(startingPosition);
+        bool isLoop = guard.walkDetectLoop(map);
+
+        map(coord.row, coord.col) = FieldType::Empty;
+        return isLoop;
+    }
+
+    int
+    createLoops(const std::unordered_set<Coord, CoordHash> &visitedCoords, const Coord &startingPosition, const Map &map) {
+        // Every candidate obstacle is tried on the worker's own copy of the map.
+        std::vector<Coord> candidates(visitedCoords.begin(), visitedCoords.end());
+        scheduler::PerWorker<Map> maps(map);
+        size_t numCreatedLoops = scheduler::parallelCount(size_t{0}, candidates.size(), [&](size_t i) {
+            return placeObstacleAndDetectLoop(startingPosition, candidates[i], maps.local());
+        });
+        return static_cast<int>(numCreatedLoops);
+    }
+
+    int execute(const Map &map) {
+        auto guardPosition = findGuardPosition(map);
+        Guard guard(guardPosition);
+        guard.walk(map);
+        auto visitedCoords = guard.getVisitedCoords();
+
+        return createLoops(visitedCoords, guardPosition, map);
+    }
+}
+
+namespace day06 {
+    struct Solver {
+        using Input = Map;
+
+        static Input parse(std::string_view text) {
+            return parseInput(text);
+        }
+
+        static solver::Answer part1(const Input &input) {
+            return day06::part1::execute(input);
+        }
+
+        static solver::Answer part2(const Input &input) {
+            return day06::part2::execute(input);
+        }
+    };
+
+    const bool registered = solver::registerSolver<Solver>(6);
+}
@@ -0,0 +1,148 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <numeric>
+#include <span>
+#include <string_view>
+#include "arena.h"
+#include "input.h"
+#include "jagged.h"
+#include "scheduler.h"
+#include "solver.h"
+#include <sstream>
+
+
+namespace day07 {
+
+    using OperandType = uint64_t;
+
+    struct Equation {
+        OperandType result{};
+        std::span<const OperandType> operands{};
+    };
+
+    struct Input {
+        // Every record is an equation's result followed by its operands.
+        Jagged<OperandType> equations;
+
+        [[nodiscard]] size_t size() const {
+            return equations.size();
+        }
+
+        Equation operator[](size_t index) const {
+            auto record = equations[index];
+            return Equation{.result = record[0], .operands = record.subspan(1)};
+        }
+    };
+
+    Input parseInput(std::string_view text) {
+        auto lines = input::splitLines(text, arena::current());
+        auto equations = buildJagged<OperandType>(lines.size(), [&lines](size_t i, std::vector<OperandType> &values) {
+            std::string_view line = lines[i];
+            auto separator = line.find(':');
+            input::parseInto<OperandType>(line.substr(0, separator), ' ', values);
+            input::parseInto<OperandType>(line.substr(separator + 1), ' ', values);
+        });
+        return Input{std::move(equations)};
+    }
+
+    using OperatorFunction = std::function<OperandType(OperandType, OperandType)>;
+
+    bool findOperators(const Equation &equation,
+                       OperandType result,
+                       int index,
+                       const std::vector<OperatorFunction> &operators) {
+
+        bool allOperandsUsedUp = static_cast<size_t>(index) == equation.operands.size() - 1;
+        if (allOperandsUsedUp) {
+            return result == equation.result;
+        }
+
+        for (const auto &func: operators) {
+            OperandType subresult = func(result, equation.operands[index + 1]);
+            if (result > equation.result) {
+                continue;
+            }
+
+            if (findOperators(equation, subresult, index + 1, operators)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    OperandType findCalibrationResult(const Input &equations,
+                                      const std::function<bool(const Equation &)> &isEquationValidFunc) {
+
+        // Lambda to compute the contribution of a single equation if it is valid
+        auto calculateContribution = [&isEquationValidFunc](const Equation &equation) -> OperandType {
+            return isEquationValidFunc(equation) ? equation.result : static_cast<OperandType>(0);
+        };
+
+        // Equations differ a lot in the number of operator combinations, so they are scheduled one by one.
+        OperandType validEquationsSum = scheduler::parallelReduce(
+                size_t{0}, equations.size(),
+                static_cast<OperandType>(0),
+                [&](size_t i) { return calculateContribution(equations[i]); },
+                std::plus<OperandType>());
+
+        return validEquationsSum;
+    }
+}
+
+namespace day07::part1 {
+
+    bool isEquationValid(const Equation &equation) {
+        const std::vector<OperatorFunction> operators = {
+                [](OperandType a, OperandType b) { return a + b; },
+                [](OperandType a, OperandType b) { return a * b; }
+        };
+        return findOperators(equation, equation.operands[0], 0, operators);
+    }
+
+    OperandType execute(const Input &equations) {
+        return findCalibrationResult(equations, isEquationValid);
+    }
+}
+
+namespace day07::part2 {
+
+    bool isEquationValid(const Equation &equation) {
+        const std::vector<OperatorFunction> operators = {
+                [](OperandType a, OperandType b) { return a + b; },
+                [](OperandType a, OperandType b) { return a * b; },
+                [](OperandType a, OperandType b) {
+                    OperandType multiplier = 1;
+                    while (multiplier <= b) {
+                        multiplier *= 10;
+                    }
+                    return a * multiplier + b;
+                }
+        };
+        return findOperators(equation, equation.operands[0], 0, operators);
+    }
+
+    OperandType execute(const Input &equations) {
+        return findCalibrationResult(equations, isEquationValid);
+    }
+}
+
+namespace day07 {
+    struct Solver {
+        using Input = day07::Input;
+
+        static Input parse(std::string_view text) {
+            return parseInput(text);
+        }
+
+        static solver::Answer part1(const Input &input) {
+            return day07::part1::execute(input);
+        }
+
+        static solver::Answer part2(const Input &input) {
+            return day07::part2::execute(input);
+        }
+    };
+
+    const bool registered = solver::registerSolver<Solver>(7);
+}
@@ -0,0 +1,392 @@
+#include "differential.h"
+#include "input.h"
+#include "logging.h"
+#include "solver.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <queue>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace day09 {
+
+    struct Block {
+        int32_t fileId{UNOCCUPIED_FILE_ID};
+
+        static constexpr int32_t UNOCCUPIED_FILE_ID = -1;
+    };
+
+    class DiskMap {
+      public:
+        DiskMap(uint64_t size) : _blocks(size) {
+        }
+
+        uint64_t getSize() const {
+            return _blocks.size();
+        }
+
+        void setBlock(uint64_t startId, uint64_t length, int32_t fileId) {
+            if (startId + length > _blocks.size()) {
+                throw std::runtime_error("Block does not fit in the DiskMap: startId=" + std::to_string(startId) +
+                                         " length=" + std::to_string(length) + " fileId=" + std::to_string(fileId));
+            }
+            std::for_each(std::next(_blocks.begin(), startId), std::next(_blocks.begin(), startId + length),
+                          [fileId](Block &block) {
+                              block.fileId = fileId;
+                          });
+        }
+
+        std::string toString() const {
+            std::string blocks{};
+            for (const auto &block : _blocks) {
+                blocks += (block.fileId == Block::UNOCCUPIED_FILE_ID) ? ".|" : std::to_string(block.fileId) + "|";
+            }
+            return blocks;
+        }
+
+        bool empty() const noexcept {
+            return _blocks.empty();
+        }
+
+        uint64_t checksum() const {
+            uint64_t sum = 0;
+            for (size_t i = 0; i < _blocks.size(); ++i) {
+                if (_blocks[i].fileId != Block::UNOCCUPIED_FILE_ID) {
+                    sum += i * _blocks[i].fileId;
+                }
+            }
+            return sum;
+        }
+
+        auto begin() noexcept {
+            return _blocks.begin();
+        }
+        auto end() noexcept {
+            return _blocks.end();
+        }
+
+        auto begin() const noexcept {
+            return _blocks.begin();
+        }
+        auto end() const noexcept {
+            return _blocks.end();
+        }
+
+        auto cbegin() const noexcept {
+            return _blocks.cbegin();
+        }
+        auto cend() const noexcept {
+            return _blocks.cend();
+        }
+
+        Block &operator[](size_t index) {
+            return _blocks[index];
+        }
+        const Block &operator[](size_t index) const {
+            return _blocks[index];
+        }
+
+      private:
+        std::vector<Block> _blocks;
+    };
+
+    /**
+     * Go over the input and find out the size of the DiskMap.
+     */
+    class DiskMapBuilder {
+      public:
+        DiskMap build(std::vector<uint8_t> input) {
+            uint64_t numBlocks = std::accumulate(input.begin(), input.end(), 0ull);
+            DiskMap map{numBlocks};
+
+            int index = 0;
+            int fileId = 0;
+            int blockId = 0;
+
+            std::for_each(input.begin(), input.end(), [&map, &index, &blockId, &fileId](uint8_t digit) {
+                bool isFile = index % 2 == 0;
+                if (isFile) {
+                    if (digit == 0) {
+                        AOC_LOG_DEBUG("Empty file!");
+                    }
+                    map.setBlock(blockId, digit, fileId);
+                    fileId++;
+                }
+                blockId += digit;
+                index++;
+            });
+
+            return map;
+        }
+    };
+
+    using Input = DiskMap;
+
+    Input parseInput(std::string_view text) {
+        auto lines = input::splitLines(text);
+        auto &line = lines[0];
+        input::trim(line);
+
+        std::vector<uint8_t> digits{};
+        std::transform(line.cbegin(), line.cend(), std::back_inserter(digits), [](const auto &digit) {
+            if (!std::isdigit(digit)) {
+                throw std::runtime_error("Invalid input: expected a digit, found: " + std::string(1, digit));
+            }
+            return digit - '0';
+        });
+
+        DiskMapBuilder builder{};
+        return builder.build(digits);
+    }
+
+} // namespace day09
+
+namespace day09::part1 {
+
+    void shiftBlocks(DiskMap &diskMap) {
+        if (diskMap.empty())
+            return;
+
+        auto emptyBlockIt = diskMap.begin();
+        auto fileBlockItRev = std::prev(diskMap.end());
+
+        while (emptyBlockIt < fileBlockItRev) {
+            // Find next empty block from the front
+            while (emptyBlockIt < diskMap.end() && emptyBlockIt->fileId != Block::UNOCCUPIED_FILE_ID) {
+                ++emptyBlockIt;
+            }
+            // Find next occupied block from the back
+            while (fileBlockItRev > diskMap.begin() && fileBlockItRev->fileId == Block::UNOCCUPIED_FILE_ID) {
+                --fileBlockItRev;
+            }
+            if (emptyBlockIt < fileBlockItRev) {
+                // Move file block to empty block
+                emptyBlockIt->fileId = fileBlockItRev->fileId;
+                fileBlockItRev->fileId = Block::UNOCCUPIED_FILE_ID;
+            }
+        }
+    }
+
+    uint64_t execute(const Input &input) {
+        DiskMap diskMap = input;
+        AOC_LOG_DEBUG("Disk Map Size: " << diskMap.getSize());
+
+        shiftBlocks(diskMap);
+
+        return diskMap.checksum();
+    }
+} // namespace day09::part1
+
+namespace day09::part2 {
+
+    enum class SpanType { Empty, File };
+
+    struct DiskSpan {
+        uint64_t start;
+        uint64_t length;
+        int32_t fileId{Block::UNOCCUPIED_FILE_ID};
+
+        std::string toString() const {
+            return "<DiskSpan start=" + std::to_string(start) + " length=" + std::to_string(length) +
+                   " fileId=" + std::to_string(fileId) + ">";
+        }
+    };
+
+    void fillSpans(std::vector<DiskSpan> &spans, const DiskMap &diskMap, SpanType type) {
+        bool isInSpan = false;
+        uint64_t blockStartId = 0;
+        uint64_t numBlocks = 0;
+        int32_t currentFileId = Block::UNOCCUPIED_FILE_ID;
+
+        for (size_t blockId = 0; blockId < diskMap.getSize(); blockId++) {
+            const auto &block = diskMap[blockId];
+
+            bool isEmptyBlock = (block.fileId == Block::UNOCCUPIED_FILE_ID);
+            bool matchesSpanType = (type == SpanType::Empty) ? isEmptyBlock : !isEmptyBlock;
+
+            if (matchesSpanType) {
+                if (!isInSpan) {
+                    isInSpan = true;
+                    blockStartId = blockId;
+                    numBlocks = 0;
+                    currentFileId = block.fileId;
+                } else if (type == SpanType::File && block.fileId != currentFileId) {
+                    spans.push_back(DiskSpan{.start = blockStartId, .length = numBlocks, .fileId = currentFileId});
+                    blockStartId = blockId;
+                    numBlocks = 0;
+                    currentFileId = block.fileId;
+                }
+                numBlocks++;
+            } else {
+                if (isInSpan) {
+                    spans.push_back(DiskSpan{.start = blockStartId, .length = numBlocks, .fileId = currentFileId});
+                    isInSpan = false;
+                }
+            }
+        }
+        if (isInSpan) {
+            spans.push_back(DiskSpan{.start = blockStartId, .length = numBlocks, .fileId = currentFileId});
+        }
+    }
+
+    void defragmentSpans(std::vector<DiskSpan> &fileSpans, std::vector<DiskSpan> &emptySpans) {
+        for (auto fIt = fileSpans.rbegin(); fIt != fileSpans.rend(); ++fIt) {
+            auto &fileSpan = *fIt;
+
+            for (auto emptyIt = emptySpans.begin(); emptyIt != emptySpans.end();) {
+                if (emptyIt->start >= fileSpan.start) {
+                    break;
+                }
+
+                if (emptyIt->length < fileSpan.length) {
+                    ++emptyIt;
+                    continue;
+                }
+
+                fileSpan.start = emptyIt->start;
+
+                if (emptyIt->length > fileSpan.length) {
+                    emptyIt->start += fileSpan.length;
+                    emptyIt->length -= fileSpan.length;
+                } else {
+                    // Remove fully consumed span in O(1)
+                    emptyIt = emptySpans.erase(emptyIt);
+                }
+
+                break; // file span placed, go to next file
+            }
+        }
+    }
+
+    /**
+     * Moves the files like defragmentSpans(), which scans the empty spans from the left for every
+     * file. Here the empty spans are in min-heaps by start, one per length up to the longest file,
+     * the last one holding the longer spans too. The leftmost span a file fits is the least of the
+     * tops of the heaps of its length and above.
+     */
+    void defragmentSpansByLength(std::vector<DiskSpan> &fileSpans, const std::vector<DiskSpan> &emptySpans) {
+        uint64_t longestFile = 0;
+        for (const auto &fileSpan : fileSpans) {
+            longestFile = std::max(longestFile, fileSpan.length);
+        }
+
+        // Start and length of an empty span.
+        using Space = std::pair<uint64_t, uint64_t>;
+        using Spaces = std::priority_queue<Space, std::vector<Space>, std::greater<>>;
+        std::vector<Spaces> spacesByLength(longestFile + 1);
+        auto addSpace = [&](uint64_t start, uint64_t length) {
+            if (length > 0) {
+                spacesByLength[std::min(length, longestFile)].emplace(start, length);
+            }
+        };
+        for (const auto &emptySpan : emptySpans) {
+            addSpace(emptySpan.start, emptySpan.length);
+        }
+
+        for (auto fIt = fileSpans.rbegin(); fIt != fileSpans.rend(); ++fIt) {
+            auto &fileSpan = *fIt;
+
+            Spaces *leftmost = nullptr;
+            for (auto length = fileSpan.length; length <= longestFile; length++) {
+                auto &spaces = spacesByLength[length];
+                if (!spaces.empty() && spaces.top().first < fileSpan.start &&
+                    (leftmost == nullptr || spaces.top().first < leftmost->top().first)) {
+                    leftmost = &spaces;
+                }
+            }
+            if (leftmost == nullptr) {
+                continue;
+            }
+
+            auto [start, length] = leftmost->top();
+            leftmost->pop();
+            fileSpan.start = start;
+            addSpace(start + fileSpan.length, length - fileSpan.length);
+        }
+    }
+
+    void reconstruct(DiskMap &diskMap, const std::vector<DiskSpan> &fileSpans) {
+        for (auto &block : diskMap) {
+            block.fileId = Block::UNOCCUPIED_FILE_ID;
+        }
+        for (const auto &span : fileSpans) {
+            for (uint64_t i = span.start; i < span.start + span.length; i++) {
+                diskMap[i].fileId = span.fileId;
+            }
+        }
+    }
+
+    template<typename Defragment>
+    void defragment(DiskMap &diskMap, Defragment moveFiles) {
+        std::vector<DiskSpan> emptySpans{};
+        fillSpans(emptySpans, diskMap, SpanType::Empty);
+
+        std::vector<DiskSpan> fileSpans{};
+        fillSpans(fileSpans, diskMap, SpanType::File);
+
+        moveFiles(fileSpans, emptySpans);
+
+        reconstruct(diskMap, fileSpans);
+
+        // std::puts("Empty spans:");
+        // for (const auto &span : emptySpans)  {
+        //     std::cout << "\t" << span.toString() << "\n";
+        // }
+
+        // std::puts("File spans:");
+        // for (const auto &span : fileSpans) {
+        //     std::cout << "\t" << span.toString() << "\n";
+        // }
+    }
+
+    uint64_t execute(const Input &input) {
+        DiskMap diskMap = input;
+
+        defragment(diskMap, defragmentSpansByLength);
+
+        return diskMap.checksum();
+    }
+
+    /**
+     * The oracle of execute(), see differential.h.
+     */
+    uint64_t executeReference(const Input &input) {
+        DiskMap diskMap = input;
+
+        defragment(diskMap, defragmentSpans);
+
+        return diskMap.checksum();
+    }
+} // namespace day09::part2
+
+namespace day09 {
+    struct Solver {
+        using Input = day09::Input;
+
+        static Input parse(std::string_view text) {
+            return parseInput(text);
+        }
+
+        static solver::Answer part1(const Input &input) {
+            return day09::part1::execute(input);
+        }
+
+        static solver::Answer part2(const Input &input) {
+            return day09::part2::execute(input);
+        }
+    };
+
+    const bool registered = solver::registerSolver<Solver>(9);
+
+    const bool checked = differential::registerCheck<Solver>(9, 2, "defragmentSpans", part2::executeReference,
+                                                             part2::execute);
+}
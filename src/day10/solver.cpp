@@ -0,0 +1,160 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <string_view>
+#include "input.h"
+#include "solver.h"
+#include "array2d.h"
+#include "grid_search.h"
+#include "Coord.h"
+
+
+namespace day10 {
+
+    using Map = Array2D<int>;
+
+    int transformInputIntoIntegers(char character) {
+        if (character == '.') {
+            return -1;
+        }
+        return character - '0';
+    }
+
+    Map parseInput(std::string_view text) {
+        auto lines = input::splitLines(text);
+        auto map = input::load2D<int>(lines, transformInputIntoIntegers);
+        return map;
+    }
+
+}
+
+namespace day10::part1 {
+
+    /**
+     * Counts the summits reachable from every trailhead with one breadth-first search per
+     * trailhead; the search only resets the tiles the previous one reached.
+     */
+    int execute(const Map &input) {
+        const auto &topographicMap = input;
+        grid_search::GridStates tiles(topographicMap.rows(), topographicMap.cols());
+        grid_search::Bfs search(tiles.count());
+        auto climb = [&](grid_search::State state, auto &&emit) {
+            auto coord = tiles.coord(state);
+            int nextValue = topographicMap(coord.row, coord.col) + 1;
+            for (auto direction: getAllDirections()) {
+                auto neighbor = coord + direction;
+                if (tiles.contains(neighbor) && topographicMap(neighbor.row, neighbor.col) == nextValue) {
+                    emit(tiles.encode(neighbor));
+                }
+            }
+        };
+
+        int score = 0;
+        for (grid_search::State state = 0; state < tiles.count(); state++) {
+            // If starting position
+            if (topographicMap[state] == 0) {
+                search.run({state}, climb);
+                for (auto reached: search.reachedStates()) {
+                    if (topographicMap[reached] == 9) {
+                        score++;
+                    }
+                }
+            }
+        }
+        return score;
+    }
+}
+
+namespace day10::part2 {
+
+    void increaseCountIfValid(int targetValue, Coord targetCoord, Coord currentCoord, const Map &topographicalMap,
+                              Map &neighborCounts, Map &currentCounts) {
+        if (!topographicalMap.isInBounds(targetCoord.row, targetCoord.col)) {
+            return;
+        }
+        int actualValue = topographicalMap(targetCoord.row, targetCoord.col);
+        if (actualValue != targetValue) {
+            return;
+        }
+        neighborCounts(targetCoord.row, targetCoord.col) += currentCounts(currentCoord.row, currentCoord.col);
+    }
+
+    int countTrails(const Map &topographicMap, const Map &zeroNumberCounts) {
+        int trailCount = 0;
+        for (int row = 0; row < topographicMap.rows(); row++) {
+            for (int col = 0; col < topographicMap.cols(); col++) {
+                // If we are at the number of interest
+                if (topographicMap(row, col) == 0) {
+                    trailCount += zeroNumberCounts(row, col);
+                }
+            }
+        }
+        return trailCount;
+    }
+
+    int countDistinctTrails(const Map &topographicMap) {
+        auto rows = topographicMap.rows();
+        auto cols = topographicMap.cols();
+        // Initialize the counts of neighbors that are smaller by 1
+        std::array<Map, 10> smallerNeighborCounts;
+        for (int dir = 0; dir < 10; ++dir) {
+            smallerNeighborCounts[dir] = Map(topographicMap.rows(), topographicMap.cols());
+        }
+        // Set all values of 1 to the first map to simplify the algorithm.
+        std::fill(smallerNeighborCounts[0].begin(), smallerNeighborCounts[0].end(), 1);
+
+        for (int i = 0; i < 9; i++) {
+            int currentValue = 9 - i;
+            int smallerNeighborValue = currentValue - 1;
+            auto &currentCounts = smallerNeighborCounts[i];
+            auto &neighborCounts = smallerNeighborCounts[i + 1];
+
+            for (int row = 0; row < rows; row++) {
+                for (int col = 0; col < cols; col++) {
+                    // If we are at the number of interest
+                    if (topographicMap(row, col) == currentValue) {
+                        // We look at its neighbors and increase the count for their location if they are smaller by 1
+                        auto coord = Coord{.col=col, .row=row};
+                        increaseCountIfValid(smallerNeighborValue, coord.getUpCoord(), coord, topographicMap,
+                                             neighborCounts, currentCounts);
+                        increaseCountIfValid(smallerNeighborValue, coord.getDownCoord(), coord, topographicMap,
+                                             neighborCounts, currentCounts);
+                        increaseCountIfValid(smallerNeighborValue, coord.getLeftCoord(), coord, topographicMap,
+                                             neighborCounts, currentCounts);
+                        increaseCountIfValid(smallerNeighborValue, coord.getRightCoord(), coord, topographicMap,
+                                             neighborCounts, currentCounts);
+                    }
+
+                }
+            }
+        }
+
+        int trailCount = countTrails(topographicMap, smallerNeighborCounts[9]);
+        return trailCount;
+    }
+
+    int execute(const Map &input) {
+        return countDistinctTrails(input);
+    }
+}
+
+namespace day10 {
+    struct Solver {
+        using Input = Map;
+
+        static Input parse(std::string_view text) {
+            return parseInput(text);
+        }
+
+        static solver::Answer part1(const Input &input) {
+            return day10::part1::execute(input);
+        }
+
+        static solver::Answer part2(const Input &input) {
+            return day10::part2::execute(input);
+        }
+    };
+
+    const bool registered = solver::registerSolver<Solver>(10);
+}
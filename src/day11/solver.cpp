@@ -0,0 +1,184 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+#include "input.h"
+#include "solver.h"
+#include "print.h"
+#include "array2d.h"
+#include <cmath>
+
+namespace day11 {
+
+    using Input = std::vector<uint64_t>;
+
+    /**
+     * Calls function(stone) for the stones of the first line. Usable in constant expressions.
+     */
+    template<typename Function>
+    constexpr void forEachStone(std::string_view text, Function &&function) {
+        auto firstLine = text.substr(0, text.find('\n'));
+        input::forEachField(firstLine, ' ', [&function](std::string_view field) {
+            function(static_cast<uint64_t>(input::parseInteger(field)));
+        });
+    }
+
+    constexpr size_t countStones(std::string_view text) {
+        size_t count = 0;
+        forEachStone(text, [&count](uint64_t) { count++; });
+        return count;
+    }
+
+    Input parseInput(std::string_view text) {
+        Input stones{};
+        stones.reserve(countStones(text));
+        forEachStone(text, [&stones](uint64_t stone) { stones.push_back(stone); });
+        return stones;
+    }
+
+#ifdef AOC_EMBEDDED_INPUT
+    // Parsed by the compiler, only the solve is left to the runtime.
+    constexpr auto EMBEDDED_STONES = []() {
+        std::array<uint64_t, countStones(embedded::INPUT)> stones{};
+        size_t index = 0;
+        forEachStone(embedded::INPUT, [&](uint64_t stone) { stones[index++] = stone; });
+        return stones;
+    }();
+#endif
+
+}
+
+namespace day11::part1 {
+
+    template<class T>
+    int countDigits(T number) {
+        int digits = 0;
+        if (number < 0)
+            digits = 1; // remove this line if '-' counts as a digit
+        while (number) {
+            number /= 10;
+            digits++;
+        }
+        return digits;
+    }
+
+    /**
+     * The one or two stones a stone turns into, by value, as there is one result per stone and blink.
+     */
+    struct Stones {
+        size_t count = 0;
+        std::array<uint64_t, 2> values{};
+
+        void push_back(uint64_t value) {
+            values[count++] = value;
+        }
+
+        [[nodiscard]] const uint64_t *begin() const {
+            return values.data();
+        }
+
+        [[nodiscard]] const uint64_t *end() const {
+            return values.data() + count;
+        }
+    };
+
+    Stones processSingleNumber(const uint64_t &number) {
+        Stones newNumbers{};
+        int numDigits = countDigits(number);
+        if (number == 0l) {
+            newNumbers.push_back(1l);
+        } else if (numDigits % 2 == 0) {
+            auto factor = static_cast<uint64_t>(std::pow(10, numDigits / 2));
+            auto firstHalf = static_cast<uint64_t>(number / factor);
+            auto secondHalf = static_cast<uint64_t>(number % factor);
+
+            newNumbers.push_back(firstHalf);
+            newNumbers.push_back(secondHalf);
+        } else {
+            newNumbers.push_back(number * 2024l);
+        }
+        return newNumbers;
+    }
+
+    std::vector<uint64_t> blink(const std::vector<uint64_t> &numbers) {
+        std::vector<uint64_t> newNumbers{};
+        for (const auto &number: numbers) {
+            auto resultingNumbers = processSingleNumber(number);
+            newNumbers.insert(newNumbers.end(), resultingNumbers.begin(), resultingNumbers.end());
+        }
+        return newNumbers;
+    }
+
+    size_t execute(const Input &input) {
+        std::vector<uint64_t> numbers = input;
+
+        for (int i = 0; i < 25; i++) {
+            numbers = blink(numbers);
+        }
+
+        return numbers.size();
+    }
+}
+
+namespace day11::part2 {
+
+    std::unordered_map<uint64_t, uint64_t> blink(const std::unordered_map<uint64_t, uint64_t> &stoneCounts) {
+        std::unordered_map<uint64_t, uint64_t> newCounts{};
+        for (const auto &[number, count]: stoneCounts) {
+            auto resultingNumbers = part1::processSingleNumber(number);
+
+            for (const auto &resultingNumber: resultingNumbers) {
+                newCounts[resultingNumber] += count;
+            }
+        }
+        return newCounts;
+    }
+
+    uint64_t execute(const Input &input) {
+        std::unordered_map<uint64_t, uint64_t> stoneCounts{};
+        for (const auto &number: input) {
+            stoneCounts[number] += 1l;
+        }
+
+        for (int i = 0; i < 75; i++) {
+            stoneCounts = blink(stoneCounts);
+        }
+
+        return std::accumulate(stoneCounts.begin(), stoneCounts.end(), 0l,
+                               [](uint64_t sum, const std::pair<uint64_t, uint64_t> &pair) {
+                                   return sum + pair.second;
+                               });
+    }
+}
+
+namespace day11 {
+    struct Solver {
+        using Input = day11::Input;
+
+        static Input parse(std::string_view text) {
+#ifdef AOC_EMBEDDED_INPUT
+            if (text.data() == embedded::INPUT.data()) {
+                return Input(EMBEDDED_STONES.begin(), EMBEDDED_STONES.end());
+            }
+#endif
+            return parseInput(text);
+        }
+
+        static solver::Answer part1(const Input &input) {
+            return day11::part1::execute(input);
+        }
+
+        static solver::Answer part2(const Input &input) {
+            return day11::part2::execute(input);
+        }
+    };
+
+    const bool registered = solver::registerSolver<Solver>(11);
+}
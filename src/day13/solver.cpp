@@ -0,0 +1,102 @@
+#include <string>
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include <numeric>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include "Coord.h"
+#include "input.h"
+#include "logging.h"
+#include "solver.h"
+#include "print.h"
+#include "array2d.h"
+
+
+namespace day13 {
+
+    struct Configuration {
+        Coord buttonA;
+        Coord buttonB;
+        Coord prizeLocation;
+    };
+
+    Configuration parseConfiguration(const std::string &string) {
+        auto matches = input::parseVector(string, R"(.*\+(\d+),\s*Y\+(\d+)\s*.*\+(\d+),\s*Y\+(\d+)\s*.*X=(\d+),\s*Y=(\d+))");
+        auto numbers = input::convertStringsToNumbers<int>(matches);
+        Coord buttonA{.col=numbers[0], .row=numbers[1]};
+        Coord buttonB{.col=numbers[2], .row=numbers[3]};
+        Coord prizeLocation{.col=numbers[4], .row=numbers[5]};
+        return {buttonA, buttonB, prizeLocation};
+    }
+
+    using Input = std::vector<Configuration>;
+
+    Input parseInput(std::string_view text) {
+        auto content = std::string(text);
+        auto parts = input::split(content, "\n\n", input::Blanks::Remove);
+
+        std::vector<Configuration> configurations{};
+        configurations.reserve(parts.size());
+
+        std::for_each(parts.cbegin(), parts.cend(), [&configurations](const std::string &part) {
+            configurations.push_back(parseConfiguration(part));
+        });
+
+        return configurations;
+    }
+
+}
+
+namespace day13::part1 {
+
+    bool hasSolution(const Configuration &config) {
+        // Use determinant to calculate det(A) = a1 * b2 − a2 * b1, det != 0 => has solution
+        // Products of int coordinates need 64 bits.
+        int64_t a1 = config.buttonA.col;
+        int64_t a2 = config.buttonA.row;
+        int64_t b1 = config.buttonB.col;
+        int64_t b2 = config.buttonB.row;
+        int64_t det = a1 * b2 - a2 * b1;
+        return det != 0;
+    }
+
+    // Unfinished: lists the machines that have a solution, there is no answer yet.
+    solver::Answer execute(const Input &input) {
+        const std::vector<Configuration> &configurations = input;
+        for (const auto &config : configurations) {
+            if (hasSolution(config)) {
+                AOC_LOG_DEBUG("has solution:" << config.prizeLocation << " " << config.buttonA << " " << config.buttonB);
+            }
+        }
+        return {};
+    }
+}
+
+namespace day13::part2 {
+
+    solver::Answer execute(const Input &input) {
+        return {};
+    }
+}
+
+namespace day13 {
+    struct Solver {
+        using Input = day13::Input;
+
+        static Input parse(std::string_view text) {
+            return parseInput(text);
+        }
+
+        static solver::Answer part1(const Input &input) {
+            return day13::part1::execute(input);
+        }
+
+        static solver::Answer part2(const Input &input) {
+            return day13::part2::execute(input);
+        }
+    };
+
+    const bool registered = solver::registerSolver<Solver>(13);
+}
@@ -0,0 +1,178 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include <numeric>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include "checked.h"
+#include "input.h"
+#include "solver.h"
+#include "logging.h"
+#include "print.h"
+#include "array2d.h"
+#include "Coord.h"
+
+
+namespace day14 {
+
+    struct Robot {
+        Coord position;
+        Coord velocity;
+    };
+
+    Robot parseRobot(const std::string &line) {
+        auto parts = input::parseVector(line, R"(p=(-?\d+),(-?\d+) v=(-?\d+),(-?\d+))");
+        auto numbers = input::convertStringsToNumbers<int>(parts);
+        Coord position{.col=numbers[0], .row=numbers[1]};
+        Coord velocity{.col=numbers[2], .row=numbers[3]};
+        return Robot{position, velocity};
+    }
+
+    using Input = std::vector<Robot>;
+
+    Input parseInput(std::string_view text) {
+        auto lines = input::splitLines(text);
+        std::vector<Robot> robots{};
+
+        for (const auto &line: lines) {
+            robots.push_back(parseRobot(line));
+        }
+        return robots;
+    }
+
+}
+
+namespace day14::part1 {
+
+    void setNewRobotPositions(std::vector<Robot> &robots, int width, int height, int seconds) {
+        for (auto &robot: robots) {
+            auto &position = robot.position;
+            auto &velocity = robot.velocity;
+
+            auto newPosX = (position.col + (velocity.col * seconds)) % width;
+            auto newPosY = (position.row + (velocity.row * seconds)) % height;
+
+            // Handle negative numbers
+            newPosX = (newPosX + width) % width;
+            newPosY = (newPosY + height) % height;
+
+            position.col = newPosX;
+            position.row = newPosY;
+        }
+    }
+
+    /**
+     * The product of four quadrant counts outgrows int from a few hundred robots per quadrant, so it is
+     * taken in 128 bits and throws if even those overflow.
+     */
+    checked::Wide determineSafetyFactor(const std::vector<Robot> &robots, int width, int height) {
+        int xThreshold = (width - 1) / 2;
+        int yThreshold = (height - 1) / 2;
+
+        checked::Wide topLeft{};
+        checked::Wide topRight{};
+        checked::Wide bottomLeft{};
+        checked::Wide bottomRight{};
+
+        for (const auto &robot: robots) {
+            const auto &pos = robot.position;
+
+            if (pos.col < xThreshold && pos.row < yThreshold) {
+                topLeft++;
+            } else if (pos.col < xThreshold && pos.row > yThreshold) {
+                bottomLeft++;
+            } else if (pos.col > xThreshold && pos.row < yThreshold) {
+                topRight++;
+            } else if (pos.col > xThreshold && pos.row > yThreshold) {
+                bottomRight++;
+            }
+        }
+        return checked::mul(checked::mul(topLeft, topRight), checked::mul(bottomLeft, bottomRight));
+    }
+
+    checked::Wide execute(const Input &input) {
+        int durationInSeconds = 100;
+        int width = 101;
+        int height = 103;
+
+        std::vector<Robot> robots = input;
+        setNewRobotPositions(robots, width, height, durationInSeconds);
+        return determineSafetyFactor(robots, width, height);
+    }
+}
+
+namespace day14::part2 {
+
+    template<typename Iterator>
+    int getMaxRobotsInSequence(Iterator begin, Iterator end) {
+        int maxRobotsInLine = 0;
+        int currentRobotsInLine = 0;
+
+        for (auto it = begin; it != end; ++it) {
+            if (*it == 1) {
+                currentRobotsInLine++;
+            } else {
+                maxRobotsInLine = std::max(maxRobotsInLine, currentRobotsInLine);
+                currentRobotsInLine = 0;
+            }
+        }
+        maxRobotsInLine = std::max(maxRobotsInLine, currentRobotsInLine);
+        return maxRobotsInLine;
+    }
+
+    bool isTreeCandidate(Array2D<int> &map, int width, int height, int minRobotsInSequence) {
+        int maxRobotsInLine = 0;
+        for (int row = 0; row < map.rows(); row++) {
+            auto robotsInLine = getMaxRobotsInSequence(map.rowBegin(row), map.rowEnd(row));
+            maxRobotsInLine = std::max(maxRobotsInLine, robotsInLine);
+        }
+
+        return maxRobotsInLine >= minRobotsInSequence;
+    }
+
+    int execute(const Input &input) {
+        int width = 101;
+        int height = 103;
+        int minRobotsInSequence = 10;
+
+        std::vector<Robot> robots{};
+        Array2D<int> map(height, width);
+        int durationInSeconds = 0;
+        do {
+            robots = input;
+            durationInSeconds++;
+            part1::setNewRobotPositions(robots, width, height, durationInSeconds);
+
+            std::fill(map.begin(), map.end(), 0);
+            for (const auto &robot: robots) {
+                map(robot.position.row, robot.position.col) = 1;
+            }
+        } while (!isTreeCandidate(map, width, height, minRobotsInSequence));
+
+        AOC_LOG_DEBUG('\n' << renderGrid(map));
+        return durationInSeconds;
+    }
+}
+
+namespace day14 {
+    struct Solver {
+        using Input = day14::Input;
+
+        static Input parse(std::string_view text) {
+            return parseInput(text);
+        }
+
+        static solver::Answer part1(const Input &input) {
+            return day14::part1::execute(input);
+        }
+
+        static solver::Answer part2(const Input &input) {
+            return day14::part2::execute(input);
+        }
+    };
+
+    const bool registered = solver::registerSolver<Solver>(14);
+}
@@ -0,0 +1,293 @@
+#include <string>
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include <numeric>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include "Coord.h"
+#include "arena.h"
+#include "input.h"
+#include "logging.h"
+#include "solver.h"
+#include "print.h"
+#include "simd.h"
+#include "array2d.h"
+#include "Direction.h"
+
+
+namespace day15 {
+
+    struct Input {
+        Array2D<char> warehouse;
+        std::string movements;
+    };
+
+    Input parseInput(std::string_view text) {
+        auto *scratch = arena::current();
+        auto mainParts = input::split(text, "\n\n", input::Blanks::Remove, scratch);
+        auto warehouseLines = input::split(mainParts[0], '\n', input::Blanks::Allow, scratch);
+        auto warehouse = input::load2D<char>(warehouseLines, [](char character) { return character; });
+
+        std::string movements{};
+        movements.reserve(mainParts[1].size());
+        for (const auto &line: input::split(mainParts[1], '\n', input::Blanks::Allow, scratch)) {
+            movements += line;
+        }
+        return {warehouse, movements};
+    }
+
+    std::optional<Coord> findRobot(const Array2D<char> &warehouse) {
+        auto flatIndex = simd::findByte(std::string_view(warehouse.data(), warehouse.size()), '@');
+        if (flatIndex != std::string_view::npos) {
+            auto coord = warehouse.toIndex2D(static_cast<int>(flatIndex));
+            return coord;
+        }
+        return std::nullopt;
+    }
+
+    Coord getDirectionIncrements(Direction direction) {
+        int rowIncrement = 0;
+        int colIncrement = 0;
+
+        switch (direction) {
+            case Direction::Right:
+                colIncrement = 1;
+                break;
+            case Direction::Left:
+                colIncrement = -1;
+                break;
+            case Direction::Up:
+                rowIncrement = -1;
+                break;
+            case Direction::Down:
+                rowIncrement = 1;
+                break;
+        }
+        return Coord{.col=colIncrement, .row=rowIncrement};
+    }
+
+    Direction directionFromMovementChar(char movement) {
+        if (movement == '>') {
+            return Direction::Right;
+        } else if (movement == '<') {
+            return Direction::Left;
+        } else if (movement == '^') {
+            return Direction::Up;
+        } else if (movement == 'v') {
+            return Direction::Down;
+        } else {
+            throw std::runtime_error("Unrecognized movement symbol.");
+        }
+    }
+
+    template<typename ShiftFunction>
+    Coord executeMovement(Direction direction, Coord robotPosition, Array2D<char> &warehouse, ShiftFunction shift) {
+        auto adjacentPosition = robotPosition + getDirectionIncrements(direction);
+        bool shiftSuccessful = shift(robotPosition, adjacentPosition, warehouse, direction);
+        if (shiftSuccessful) {
+            return adjacentPosition;
+        } else {
+            return robotPosition;
+        }
+    }
+
+    template<typename T, typename UnaryFunction>
+    void forEachItemWithCoords(const Array2D<T> &array, T target, UnaryFunction action) {
+        auto it = array.cbegin();
+        auto end = array.cend();
+        while (it != end) {
+            if (*it == target) {
+                size_t flatIndex = std::distance(array.cbegin(), it);
+                Coord coord = array.toIndex2D(flatIndex);
+                action(coord);
+            }
+            ++it;
+        }
+    }
+
+}
+
+namespace day15::part1 {
+
+    bool shift(Coord current, Coord adjacent, Array2D<char> &warehouse, Direction direction) {
+        // Recursive.
+        // end condition: place == ".", return true, place == '#', return false
+        // All children must return true in order to execute the shift.
+        char adjacentType = warehouse(adjacent.row, adjacent.col);
+        if (adjacentType == '.') {
+            return true;
+        } else if (adjacentType == '#') {
+            return false;
+        } else if (adjacentType == 'O'){
+            auto nextAdjacent = adjacent + getDirectionIncrements(direction);
+            bool shiftSuccessful = shift(adjacent, nextAdjacent, warehouse, direction);
+            if (shiftSuccessful) {
+                warehouse(nextAdjacent.row, nextAdjacent.col) = warehouse(adjacent.row, adjacent.col);
+                return true;
+            } else {
+                return false;
+            }
+        }
+        else {
+            // Shift robot too
+            warehouse(adjacent.row, adjacent.col) = warehouse(current.row, current.col);
+            warehouse(current.row, current.col) = '.';
+            return true;
+        }
+    }
+
+    uint64_t computeGps(const Array2D<char> &warehouse) {
+        uint64_t gpsSum = 0;
+
+        forEachItemWithCoords(warehouse, 'O', [&gpsSum](const Coord &coord) {
+            gpsSum += (coord.row * 100 + coord.col);
+        });
+        return gpsSum;
+    }
+
+    uint64_t execute(const Input &input) {
+        auto warehouse = input.warehouse;
+
+        auto robotCoord = findRobot(warehouse);
+        Coord robotPosition = *robotCoord;
+
+        for (const auto &movement: input.movements) {
+            auto direction = directionFromMovementChar(movement);
+            robotPosition = executeMovement(direction, robotPosition, warehouse, shift);
+        }
+
+        return computeGps(warehouse);
+    }
+}
+
+namespace day15::part2 {
+
+    Array2D<char> enlargeWarehouse(const Array2D<char> &warehouse) {
+        return warehouse;
+    }
+
+    bool canShift(Coord adjacent, Array2D<char> &warehouse, Direction direction) {
+        char adjacentType = warehouse(adjacent.row, adjacent.col);
+        if (adjacentType == '.') {
+            return true;
+        } else if (adjacentType == '#') {
+            return false;
+        }
+
+        if (direction == Direction::Up || direction == Direction::Down) {
+            if (adjacentType == '[') {
+                auto adjacentRight = adjacent + getDirectionIncrements(Direction::Right);
+                auto nextLeft = adjacent + getDirectionIncrements(direction);
+                auto nextRight = adjacentRight + getDirectionIncrements(direction);
+
+                return canShift(nextLeft, warehouse, direction) &&
+                       canShift(nextRight, warehouse, direction);
+            } else { // ']'
+                auto adjacentLeft = adjacent + getDirectionIncrements(Direction::Left);
+                auto nextLeft = adjacentLeft + getDirectionIncrements(direction);
+                auto nextRight = adjacent + getDirectionIncrements(direction);
+
+                return canShift(nextLeft, warehouse, direction) &&
+                       canShift(nextRight, warehouse, direction);
+            }
+        } else {
+            auto nextAdjacent = adjacent + getDirectionIncrements(direction);
+            return canShift(nextAdjacent, warehouse, direction);
+        }
+    }
+
+    void shift(Coord adjacent, Array2D<char> &warehouse, Direction direction) {
+        char adjacentType = warehouse(adjacent.row, adjacent.col);
+        if (adjacentType == '.' || adjacentType == '#') {
+            return;
+        }
+        else if (adjacentType == '[' || adjacentType == ']') {
+            if (direction == Direction::Up || direction == Direction::Down) {
+                if (adjacentType == '[') {
+                    auto adjacentRight = adjacent + getDirectionIncrements(Direction::Right);
+                    auto nextLeft = adjacent + getDirectionIncrements(direction);
+                    auto nextRight = adjacentRight + getDirectionIncrements(direction);
+
+                    shift(nextLeft, warehouse, direction);
+                    shift(nextRight, warehouse, direction);
+
+                    warehouse(nextLeft.row, nextLeft.col) = warehouse(adjacent.row, adjacent.col);
+                    warehouse(nextRight.row, nextRight.col) = warehouse(adjacentRight.row, adjacentRight.col);
+                } else { // ']'
+                    auto adjacentLeft = adjacent + getDirectionIncrements(Direction::Left);
+                    auto nextLeft = adjacentLeft + getDirectionIncrements(direction);
+                    auto nextRight = adjacent + getDirectionIncrements(direction);
+
+                    shift(nextLeft, warehouse, direction);
+                    shift(nextRight, warehouse, direction);
+
+                    warehouse(nextLeft.row, nextLeft.col) = warehouse(adjacentLeft.row, adjacentLeft.col);
+                    warehouse(nextRight.row, nextRight.col) = warehouse(adjacent.row, adjacent.col);
+                }
+            } else {
+                auto nextAdjacent = adjacent + getDirectionIncrements(direction);
+                shift(nextAdjacent, warehouse, direction);
+
+                warehouse(nextAdjacent.row, nextAdjacent.col) = warehouse(adjacent.row, adjacent.col);
+            }
+        }
+    }
+
+    uint64_t computeGps(const Array2D<char> &warehouse) {
+        uint64_t gpsSum = 0;
+
+        forEachItemWithCoords(warehouse, '[', [&gpsSum](const Coord &coord) {
+            gpsSum += (coord.row * 100 + coord.col);
+        });
+        return gpsSum;
+    }
+
+
+    bool shiftIfPossible(Coord current, Coord adjacent, Array2D<char> &warehouse, Direction direction) {
+        auto shiftIsPossible = canShift(adjacent, warehouse, direction);
+        if (shiftIsPossible) {
+            shift(adjacent, warehouse, direction);
+        }
+        return shiftIsPossible;
+    }
+
+    uint64_t execute(const Input &input) {
+        auto warehouse = enlargeWarehouse(input.warehouse);
+
+        auto robotCoord = findRobot(warehouse);
+        Coord robotPosition = *robotCoord;
+
+        for (const auto &movement: input.movements) {
+            AOC_LOG_TRACE('\n' << renderGrid(warehouse));
+
+            auto direction = directionFromMovementChar(movement);
+            robotPosition = executeMovement(direction, robotPosition, warehouse, shiftIfPossible);
+        }
+
+        AOC_LOG_DEBUG('\n' << renderGrid(warehouse));
+
+        return computeGps(warehouse);
+    }
+}
+
+namespace day15 {
+    struct Solver {
+        using Input = day15::Input;
+
+        static Input parse(std::string_view text) {
+            return parseInput(text);
+        }
+
+        static solver::Answer part1(const Input &input) {
+            return day15::part1::execute(input);
+        }
+
+        static solver::Answer part2(const Input &input) {
+            return day15::part2::execute(input);
+        }
+    };
+
+    const bool registered = solver::registerSolver<Solver>(15);
+}
@@ -0,0 +1,237 @@
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Direction.h"
+#include "arena.h"
+#include "array2d.h"
+#include "grid_search.h"
+#include "input.h"
+#include "logging.h"
+#include "print.h"
+#include "solver.h"
+
+namespace day16 {
+
+enum class CellType { Empty, Wall, Start, End, Path };
+
+std::ostream &operator<<(std::ostream &out, const CellType &cellType) {
+    switch (cellType) {
+        case CellType::Empty:
+            out << '.';
+            break;
+        case CellType::Wall:
+            out << '#';
+            break;
+        case CellType::Start:
+            out << 'S';
+            break;
+        case CellType::End:
+            out << 'E';
+            break;
+        case CellType::Path:
+            out << 'o';
+            break;
+    }
+    return out;
+}
+
+// Large maps are searched at random, see huge_pages.h.
+using Map = HugeArray2D<CellType>;
+
+struct Input {
+    Map map;
+};
+
+Input parseInput(std::string_view text) {
+    auto lines = input::splitLines(text);
+    Input input{};
+
+    input.map = input::load2D<CellType, Map::allocator_type>(lines, [](char c) {
+        switch (c) {
+            case '.':
+                return CellType::Empty;
+            case '#':
+                return CellType::Wall;
+            case 'S':
+                return CellType::Start;
+            case 'E':
+                return CellType::End;
+            default:
+                throw std::runtime_error("Unknown cell type: " + std::string(1, c));
+        }
+    });
+
+    return input;
+}
+
+Coord getPos(const Map &map, const CellType target) {
+    auto it = std::find_if(map.cbegin(), map.cend(), [target](CellType cell) { return cell == target; });
+    if (it != map.cend()) {
+        size_t col = std::distance(map.cbegin(), it) % map.cols();
+        size_t row = std::distance(map.cbegin(), it) / map.cols();
+        return Coord{.col = static_cast<int>(col), .row = static_cast<int>(row)};
+    }
+    throw std::runtime_error("Target position not found");
+}
+
+constexpr grid_search::Distance STEP_COST = 1;
+constexpr grid_search::Distance TURN_COST = 1000;
+
+/**
+ * A state is a tile and the direction the reindeer faces on it. It either steps forward or
+ * turns by 90 degrees in place.
+ */
+class Maze {
+public:
+    explicit Maze(const Map &map) : m_map(map), m_states(map.rows(), map.cols(), getAllDirections().size()) {
+    }
+
+    [[nodiscard]] const grid_search::GridStates &states() const { return m_states; }
+
+    [[nodiscard]] grid_search::State encode(Coord coord, Direction direction) const {
+        return m_states.encode(coord, static_cast<std::size_t>(direction));
+    }
+
+    [[nodiscard]] Direction direction(grid_search::State state) const {
+        return static_cast<Direction>(m_states.layer(state));
+    }
+
+    [[nodiscard]] bool isOpen(Coord coord) const {
+        return m_states.contains(coord) && m_map(coord.row, coord.col) != CellType::Wall;
+    }
+
+    template<typename Emit>
+    void forward(grid_search::State state, Emit &&emit) const {
+        auto coord = m_states.coord(state);
+        auto facing = direction(state);
+        if (isOpen(coord + facing)) {
+            emit(encode(coord + facing, facing), STEP_COST);
+        }
+        turns(coord, facing, emit);
+    }
+
+    /**
+     * The reversed edges: a state is entered by a step from the tile behind it or by a turn.
+     */
+    template<typename Emit>
+    void backward(grid_search::State state, Emit &&emit) const {
+        auto coord = m_states.coord(state);
+        auto facing = direction(state);
+        if (isOpen(coord - facing)) {
+            emit(encode(coord - facing, facing), STEP_COST);
+        }
+        turns(coord, facing, emit);
+    }
+
+private:
+    template<typename Emit>
+    void turns(Coord coord, Direction facing, Emit &emit) const {
+        for (auto direction : getAllDirections()) {
+            if (direction != facing && direction != getOpposite(facing)) {
+                emit(encode(coord, direction), TURN_COST);
+            }
+        }
+    }
+
+    const Map &m_map;
+    grid_search::GridStates m_states;
+};
+
+}  // namespace day16
+
+namespace day16::part1 {
+
+int execute(const Input &input) {
+    auto start = getPos(input.map, CellType::Start);
+    auto end = getPos(input.map, CellType::End);
+    AOC_LOG_DEBUG("Start: " << start << ", End: " << end);
+
+    Maze maze(input.map);
+    grid_search::Dijkstra search(maze.states().count(), TURN_COST);
+    auto reached = search.run(
+            {maze.encode(start, Direction::Right)},
+            [&maze](grid_search::State state, auto &&emit) { maze.forward(state, emit); },
+            [&maze, end](grid_search::State state) { return maze.states().coord(state) == end; });
+    if (reached == grid_search::NO_STATE) {
+        return -1;
+    }
+    return static_cast<int>(search.distance(reached));
+}
+
+}  // namespace day16::part1
+
+namespace day16::part2 {
+
+size_t execute(const Input &input, bool verbose = false) {
+    auto start = getPos(input.map, CellType::Start);
+    auto end = getPos(input.map, CellType::End);
+    AOC_LOG_DEBUG("Start: " << start << ", End: " << end);
+
+    // A tile is on a best path when the costs from the start to it and from it to the end add up
+    // to the best cost in some direction.
+    Maze maze(input.map);
+    grid_search::Dijkstra fromStart(maze.states().count(), TURN_COST);
+    grid_search::Dijkstra toEnd(maze.states().count(), TURN_COST);
+    fromStart.run({maze.encode(start, Direction::Right)},
+                  [&maze](grid_search::State state, auto &&emit) { maze.forward(state, emit); });
+
+    std::vector<grid_search::State> endStates{};
+    auto bestCost = grid_search::UNREACHED;
+    for (auto direction : getAllDirections()) {
+        endStates.push_back(maze.encode(end, direction));
+        bestCost = std::min(bestCost, fromStart.distance(endStates.back()));
+    }
+    if (bestCost == grid_search::UNREACHED) {
+        return 0;
+    }
+    toEnd.run(endStates, [&maze](grid_search::State state, auto &&emit) { maze.backward(state, emit); });
+
+    std::pmr::vector<bool> tilesOnAnyPath(input.map.size(), false, arena::current());
+    size_t tileCount = 0;
+    for (auto state : fromStart.reachedStates()) {
+        if (toEnd.reached(state) && fromStart.distance(state) + toEnd.distance(state) == bestCost) {
+            auto tile = state / getAllDirections().size();
+            if (!tilesOnAnyPath[tile]) {
+                tilesOnAnyPath[tile] = true;
+                tileCount++;
+            }
+        }
+    }
+
+    if (verbose) {
+        Map outputMap = input.map;
+        for (size_t tile = 0; tile < tilesOnAnyPath.size(); tile++) {
+            if (tilesOnAnyPath[tile]) {
+                outputMap[tile] = CellType::Path;
+            }
+        }
+        AOC_LOG_INFO('\n' << renderGrid(outputMap));
+    }
+    return tileCount;
+}
+
+}  // namespace day16::part2
+
+namespace day16 {
+struct Solver {
+    using Input = day16::Input;
+
+    static Input parse(std::string_view text) {
+        return parseInput(text);
+    }
+
+    static solver::Answer part1(const Input &input) {
+        return day16::part1::execute(input);
+    }
+
+    static solver::Answer part2(const Input &input) {
+        return day16::part2::execute(input);
+    }
+};
+
+const bool registered = solver::registerSolver<Solver>(16);
+}
@@ -0,0 +1,426 @@
+#include "array2d.h"
+#include "cycle_timer.h"
+#include "input.h"
+#include "logging.h"
+#include "print.h"
+#include "solver.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace day17 {
+
+    enum class Register { A = 0, B = 1, C = 2 };
+
+    struct InitialState {
+        std::array<int64_t, 3> registers;
+    };
+
+    enum class OpCode { Adv = 0, Bxl = 1, Bst = 2, Jnz = 3, Bxc = 4, Out = 5, Bdv = 6, Cdv = 7 };
+
+    struct Instruction {
+        OpCode opcode;
+        int64_t operand;
+    };
+
+    struct Program {
+        std::vector<Instruction> instructions;
+    };
+
+    struct Input {
+        InitialState initialState;
+        Program program;
+    };
+
+    constexpr OpCode parseOpCode(int64_t code) {
+        switch (code) {
+        case 0:
+            return OpCode::Adv;
+        case 1:
+            return OpCode::Bxl;
+        case 2:
+            return OpCode::Bst;
+        case 3:
+            return OpCode::Jnz;
+        case 4:
+            return OpCode::Bxc;
+        case 5:
+            return OpCode::Out;
+        case 6:
+            return OpCode::Bdv;
+        case 7:
+            return OpCode::Cdv;
+        default:
+            throw std::runtime_error("Unknown opcode: " + std::to_string(code));
+        }
+    }
+
+    /**
+     * Calls onRegister(index, value) for every register line and onInstruction(instruction) for
+     * every instruction of the program line. Usable in constant expressions.
+     */
+    template<typename OnRegister, typename OnInstruction>
+    constexpr void scanInput(std::string_view text, OnRegister &&onRegister, OnInstruction &&onInstruction) {
+        int registerIndex = 0;
+        input::forEachField(text, '\n', [&](std::string_view line) {
+            auto separator = line.find(':');
+            if (line.starts_with("Register")) {
+                onRegister(registerIndex++, input::parseInteger(line.substr(separator + 1)));
+            } else if (line.starts_with("Program")) {
+                if (separator == std::string_view::npos) {
+                    throw std::runtime_error("Invalid program line: " + std::string(line));
+                }
+                // Opcodes and operands alternate.
+                int64_t opcode = 0;
+                bool hasOpcode = false;
+                input::forEachField(line.substr(separator + 1), ',', [&](std::string_view field) {
+                    auto value = input::parseInteger(field);
+                    if (!hasOpcode) {
+                        opcode = value;
+                        hasOpcode = true;
+                        return;
+                    }
+                    onInstruction(Instruction{.opcode = parseOpCode(opcode), .operand = value});
+                    hasOpcode = false;
+                });
+            }
+        });
+    }
+
+    constexpr size_t countInstructions(std::string_view text) {
+        size_t count = 0;
+        scanInput(text, [](int, int64_t) {}, [&count](const Instruction &) { count++; });
+        return count;
+    }
+
+    Input parseInput(std::string_view text) {
+        Input input{};
+        scanInput(text,
+                  [&input](int index, int64_t value) { input.initialState.registers.at(index) = value; },
+                  [&input](const Instruction &instruction) { input.program.instructions.push_back(instruction); });
+        return input;
+    }
+
+#ifdef AOC_EMBEDDED_INPUT
+    // Parsed by the compiler, only the solve is left to the runtime.
+    constexpr auto EMBEDDED_REGISTERS = []() {
+        std::array<int64_t, 3> registers{};
+        scanInput(embedded::INPUT, [&](int index, int64_t value) { registers[index] = value; },
+                  [](const Instruction &) {});
+        return registers;
+    }();
+
+    constexpr auto EMBEDDED_INSTRUCTIONS = []() {
+        std::array<Instruction, countInstructions(embedded::INPUT)> instructions{};
+        size_t index = 0;
+        scanInput(embedded::INPUT, [](int, int64_t) {},
+                  [&](const Instruction &instruction) { instructions[index++] = instruction; });
+        return instructions;
+    }();
+#endif
+
+    std::ostream &operator<<(std::ostream &os, const OpCode &opcode) {
+        switch (opcode) {
+        case OpCode::Adv:
+            os << "Adv";
+            break;
+        case OpCode::Bxl:
+            os << "Bxl";
+            break;
+        case OpCode::Bst:
+            os << "Bst";
+            break;
+        case OpCode::Jnz:
+            os << "Jnz";
+            break;
+        case OpCode::Bxc:
+            os << "Bxc";
+            break;
+        case OpCode::Out:
+            os << "Out";
+            break;
+        case OpCode::Bdv:
+            os << "Bdv";
+            break;
+        case OpCode::Cdv:
+            os << "Cdv";
+            break;
+        }
+        return os;
+    }
+
+    template <size_t N>
+    std::ostream &operator<<(std::ostream &os, const std::array<int64_t, N> &array) {
+        for (const auto &reg : array) {
+            os << reg << " ";
+        }
+        os << "\n";
+        return os;
+    }
+
+    std::ostream &operator<<(std::ostream &os, const Input &input) {
+        os << "Initial State:\n";
+        os << "Registers: " << input.initialState.registers << "\n";
+        os << "Program:\n";
+        for (const auto &instr : input.program.instructions) {
+            os << "Opcode: " << instr.opcode << ", Operand: " << instr.operand << "\n";
+        }
+        return os;
+    }
+
+    class IWriter {
+      public:
+        virtual void write(char value) = 0;
+    };
+
+    class Processor {
+      public:
+        Processor(std::shared_ptr<IWriter> writer) : _writer(writer) {
+        }
+
+        void setState(const InitialState &state) {
+            _registers = state.registers;
+        }
+
+        void runProgram(const Program &program) {
+            _instructionPointer = 0;
+            _previousOut = false;
+            _isInterrupted = false;
+
+            while (!_isInterrupted && _instructionPointer < program.instructions.size()) {
+                const auto &instr = program.instructions[_instructionPointer];
+                executeInstruction(instr);
+            }
+        }
+
+        void setInterrupt(bool value) {
+            _isInterrupted = value;
+        }
+
+        bool isInterrupted() const {
+            return _isInterrupted;
+        }
+
+        uint64_t executedInstructions() const {
+            return _executedInstructions;
+        }
+
+        void printState() const {
+            AOC_LOG_DEBUG("Registers: " << _registers);
+        }
+
+      private:
+        int64_t &getRegister(Register reg) {
+            return _registers[static_cast<int64_t>(reg)];
+        }
+
+        int64_t getRegister(Register reg) const {
+            return _registers[static_cast<int64_t>(reg)];
+        }
+
+        int64_t getComboOperandValue(int64_t operand) const {
+            static constexpr int64_t base = 4;
+            if (operand >= base && operand <= base + 2) {
+                return getRegister(static_cast<Register>(operand - base));
+            } else {
+                return operand;
+            }
+        }
+
+        int64_t calcDv(int64_t operand) {
+            auto combo = getComboOperandValue(operand);
+            auto numerator = getRegister(Register::A);
+            return numerator / std::pow(2, combo);
+        }
+
+        void executeInstruction(const Instruction &instr) {
+            int64_t jumpTarget = -1;
+
+            switch (instr.opcode) {
+            case OpCode::Adv: {
+                getRegister(Register::A) = calcDv(instr.operand);
+            } break;
+            case OpCode::Bxl: {
+                getRegister(Register::B) = getRegister(Register::B) ^ instr.operand;
+            } break;
+            case OpCode::Bst: {
+                auto combo = getComboOperandValue(instr.operand);
+                getRegister(Register::B) = combo & 0b111;
+            } break;
+            case OpCode::Jnz: {
+                if (getRegister(Register::A) != 0) {
+                    jumpTarget = instr.operand;
+                }
+            } break;
+            case OpCode::Bxc: {
+                getRegister(Register::B) ^= getRegister(Register::C);
+            } break;
+            case OpCode::Out: {
+                if (_previousOut) {
+                    _writer->write(',');
+                }
+                auto combo = getComboOperandValue(instr.operand);
+                _writer->write((combo & 0b111) + '0');
+                _previousOut = true;
+            } break;
+            case OpCode::Bdv: {
+                getRegister(Register::B) = calcDv(instr.operand);
+            } break;
+            case OpCode::Cdv: {
+                getRegister(Register::C) = calcDv(instr.operand);
+            } break;
+            default:
+                throw std::runtime_error("Unsupported opcode encountered.");
+            }
+
+            _instructionPointer = jumpTarget != -1 ? jumpTarget : _instructionPointer + 1;
+            _executedInstructions++;
+        }
+
+        std::shared_ptr<IWriter> _writer;
+        std::array<int64_t, 3> _registers{};
+        size_t _instructionPointer{};
+        bool _previousOut = false;
+        bool _isInterrupted = false;
+        uint64_t _executedInstructions{};
+    };
+
+} // namespace day17
+
+namespace day17::part1 {
+    class StringWriter : public IWriter {
+      public:
+        void write(char value) override {
+            _output.push_back(value);
+        }
+
+        const std::string &output() const {
+            return _output;
+        }
+
+      private:
+        std::string _output;
+    };
+
+    std::string execute(const Input &input) {
+        auto writer = std::make_shared<StringWriter>();
+        Processor processor(writer);
+        processor.setState(input.initialState);
+
+        CycleTimer cycleTimer;
+        processor.runProgram(input.program);
+        AOC_LOG_INFO("Instruction dispatch: " << cycleTimer.perItem(processor.executedInstructions()));
+        return writer->output();
+    }
+} // namespace day17::part1
+
+namespace day17::part2 {
+
+    class OutputMatcher : public IWriter {
+      public:
+        OutputMatcher(const Program &expectedProgram) : _expectedProgram(expectedProgram) {
+        }
+
+        void write(char value) override {
+            if (value == ',') {
+                return;
+            }
+            char expectedValue = getExpectedValue();
+            if (expectedValue != value) {
+                if (_processor) {
+                    _processor->setInterrupt(true);
+                    return;
+                }
+            }
+            _index++;
+        }
+
+        void setProcessor(Processor *processor) {
+            if (!processor) {
+                throw std::runtime_error("processor cannot be null");
+            }
+            _processor = processor;
+        }
+
+        void reset() {
+            _index = 0;
+        }
+
+        bool isMatched() const {
+            int64_t count = _expectedProgram.instructions.size();
+            return _index == count * 2;
+        }
+
+      private:
+        char getExpectedValue() {
+            int64_t instrIndex = static_cast<int64_t>(_index / 2);
+            int64_t isOperand = static_cast<bool>(_index % 2);
+
+            auto &instr = _expectedProgram.instructions[instrIndex];
+            int64_t value = isOperand ? instr.operand : static_cast<int64_t>(instr.opcode);
+            return value + '0';
+        }
+
+        const Program &_expectedProgram;
+        Processor *_processor;
+        int64_t _index{0};
+    };
+
+    int64_t execute(const Input &input) {
+        InitialState initialState = input.initialState;
+        auto matcher = std::make_shared<OutputMatcher>(input.program);
+        Processor processor(matcher);
+        matcher->setProcessor(&processor);
+
+        CycleTimer cycleTimer;
+        for (int64_t regA = 1; regA < std::numeric_limits<int64_t>::max(); regA++) {
+            initialState.registers[static_cast<int64_t>(Register::A)] = regA;
+            matcher->reset();
+            processor.setState(initialState);
+            processor.runProgram(input.program);
+
+            if (matcher->isMatched()) {
+                AOC_LOG_INFO("Instruction dispatch: " << cycleTimer.perItem(processor.executedInstructions()));
+                return regA;
+            }
+        }
+        throw std::runtime_error("No initial value of register A reproduces the program");
+    }
+} // namespace day17::part2
+
+namespace day17 {
+    struct Solver {
+        using Input = day17::Input;
+
+        static Input parse(std::string_view text) {
+#ifdef AOC_EMBEDDED_INPUT
+            if (text.data() == embedded::INPUT.data()) {
+                return Input{.initialState = {EMBEDDED_REGISTERS},
+                             .program = {std::vector<Instruction>(EMBEDDED_INSTRUCTIONS.begin(),
+                                                                  EMBEDDED_INSTRUCTIONS.end())}};
+            }
+#endif
+            return parseInput(text);
+        }
+
+        static solver::Answer part1(const Input &input) {
+            return day17::part1::execute(input);
+        }
+
+        static solver::Answer part2(const Input &input) {
+            return day17::part2::execute(input);
+        }
+    };
+
+    // The brute-force search of part 2 does not finish on the puzzle input.
+    const bool registered = solver::registerSolver<Solver>(17, solver::DayOptions{.slowPart2 = true});
+}
@@ -0,0 +1,34 @@
+# Writes INPUT as a constexpr byte array to the header OUTPUT, see AOC_EMBED_INPUTS in CMakeLists.txt.
+# Run as a script at build time: cmake -DINPUT=... -DOUTPUT=... -P embed_input.cmake
+
+file(READ ${INPUT} INPUT_HEX HEX)
+string(LENGTH "${INPUT_HEX}" INPUT_HEX_LENGTH)
+math(EXPR INPUT_SIZE "${INPUT_HEX_LENGTH} / 2")
+
+# Sixteen bytes per line
+string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," INPUT_BYTES "${INPUT_HEX}")
+string(REGEX REPLACE "((0x[0-9a-f][0-9a-f],){16})" "\\1\n            " INPUT_BYTES "${INPUT_BYTES}")
+
+get_filename_component(INPUT_NAME ${INPUT} NAME)
+file(WRITE ${OUTPUT}.tmp "// Generated from ${INPUT_NAME} by embed_input.cmake, do not edit.
+
+#ifndef AOC_2023_EMBEDDED_INPUT_H
+#define AOC_2023_EMBEDDED_INPUT_H
+
+#include <string_view>
+
+namespace embedded {
+    namespace {
+        // Terminated, so that an empty input is a valid array too.
+        constexpr char INPUT_BYTES[] = {
+            ${INPUT_BYTES}0x00};
+
+        constexpr std::string_view INPUT{INPUT_BYTES, ${INPUT_SIZE}};
+    }
+}
+
+#endif
+")
+# Unchanged inputs keep the header's timestamp, so that the day is not recompiled.
+file(COPY_FILE ${OUTPUT}.tmp ${OUTPUT} ONLY_IF_DIFFERENT)
+file(REMOVE ${OUTPUT}.tmp)
@@ -0,0 +1,14 @@
+#include "generator.h"
+
+namespace {
+
+    // Two columns of five-digit location ids, as in the puzzle input.
+    void generate(std::ostream &out, uint64_t size, generator::Random &random) {
+        for (uint64_t i = 0; i < size; i++) {
+            out << random.uniform(10000, 99999) << "   " << random.uniform(10000, 99999) << '\n';
+        }
+    }
+
+    const bool registered = generator::add({.day = 1, .sizeUnit = "lines", .defaultSize = 1000, .generate = generate});
+
+}
@@ -0,0 +1,28 @@
+#include "generator.h"
+
+namespace {
+
+    /**
+     * Reports of 5 to 8 levels. Most of them are monotonic with steps of 1 to 3 and then get a few
+     * levels disturbed, so that both parts see safe, almost safe and unsafe reports.
+     */
+    void generate(std::ostream &out, uint64_t size, generator::Random &random) {
+        for (uint64_t i = 0; i < size; i++) {
+            auto length = random.uniform(5, 8);
+            int64_t direction = random.chance(0.5) ? 1 : -1;
+            int64_t level = direction > 0 ? random.uniform(1, 50) : random.uniform(50, 99);
+
+            for (int64_t j = 0; j < length; j++) {
+                auto value = level;
+                if (random.chance(0.1)) {
+                    value += random.uniform(-5, 5);
+                }
+                out << std::max<int64_t>(value, 1) << (j + 1 < length ? ' ' : '\n');
+                level += direction * random.uniform(1, 3);
+            }
+        }
+    }
+
+    const bool registered = generator::add({.day = 2, .sizeUnit = "reports", .defaultSize = 1000, .generate = generate});
+
+}
@@ -0,0 +1,51 @@
+#include "generator.h"
+
+#include <string>
+
+namespace {
+
+    const std::vector<std::string> noise = {
+            "mul(", "mul[", "mul (", ")", "(", ",", "don't", "do", "what()", "who()", "select()", "from()", "where()",
+            "#", "?", "^", "{", "}", "<", ">", "[", "]", "@", "%", "*", "+", "-", "/", ":", ";", "'", "!", " ", "~",
+            "&", "$", "\n"};
+
+    std::string validInstruction(generator::Random &random) {
+        auto roll = random.uniform(0, 9);
+        if (roll == 0) {
+            return "do()";
+        }
+        if (roll == 1) {
+            return "don't()";
+        }
+        return "mul(" + std::to_string(random.uniform(1, 999)) + "," + std::to_string(random.uniform(1, 999)) + ")";
+    }
+
+    /**
+     * Corrupted memory of about `size` bytes: valid mul/do/don't instructions surrounded by noise,
+     * part of which looks almost like an instruction. Written in chunks, so gigabyte dumps are fine.
+     */
+    void generate(std::ostream &out, uint64_t size, generator::Random &random) {
+        constexpr size_t chunkSize = 1 << 16;
+
+        std::string chunk{};
+        chunk.reserve(chunkSize + 64);
+        uint64_t written = 0;
+
+        while (written < size) {
+            chunk.clear();
+            while (chunk.size() < chunkSize && written + chunk.size() < size) {
+                if (random.chance(0.3)) {
+                    chunk += validInstruction(random);
+                } else {
+                    chunk += random.pick(noise);
+                }
+            }
+            out.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+            written += chunk.size();
+        }
+        out << '\n';
+    }
+
+    const bool registered = generator::add({.day = 3, .sizeUnit = "bytes", .defaultSize = 18000, .generate = generate});
+
+}
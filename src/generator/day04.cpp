@@ -0,0 +1,22 @@
+#include "generator.h"
+
+#include <string>
+
+namespace {
+
+    // A square word search over the letters of XMAS.
+    void generate(std::ostream &out, uint64_t size, generator::Random &random) {
+        constexpr char letters[] = {'X', 'M', 'A', 'S'};
+
+        std::string row(size + 1, '\n');
+        for (uint64_t r = 0; r < size; r++) {
+            for (uint64_t c = 0; c < size; c++) {
+                row[c] = letters[random.uniform(0, 3)];
+            }
+            out << row;
+        }
+    }
+
+    const bool registered = generator::add({.day = 4, .sizeUnit = "grid side length", .defaultSize = 140, .generate = generate});
+
+}
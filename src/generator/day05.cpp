@@ -0,0 +1,51 @@
+#include "generator.h"
+
+#include <algorithm>
+
+namespace {
+
+    /**
+     * Page ordering rules for every pair of 49 two-digit pages, following one hidden total order,
+     * and `size` updates of an odd number of pages. About half of the updates are in order.
+     */
+    void generate(std::ostream &out, uint64_t size, generator::Random &random) {
+        std::vector<int64_t> pages{};
+        for (int64_t page = 11; page < 100; page++) {
+            pages.push_back(page);
+        }
+        random.shuffle(pages);
+        pages.resize(49);
+
+        std::vector<std::pair<int64_t, int64_t>> rules{};
+        for (size_t i = 0; i < pages.size(); i++) {
+            for (size_t j = i + 1; j < pages.size(); j++) {
+                rules.emplace_back(pages[i], pages[j]);
+            }
+        }
+        random.shuffle(rules);
+        for (const auto &[before, after]: rules) {
+            out << before << '|' << after << '\n';
+        }
+        out << '\n';
+
+        std::vector<size_t> indices(pages.size());
+        for (uint64_t i = 0; i < size; i++) {
+            for (size_t j = 0; j < indices.size(); j++) {
+                indices[j] = j;
+            }
+            random.shuffle(indices);
+            auto length = static_cast<size_t>(2 * random.uniform(2, 11) + 1);
+            std::vector<size_t> update(indices.begin(), indices.begin() + static_cast<std::ptrdiff_t>(length));
+            if (random.chance(0.5)) {
+                std::sort(update.begin(), update.end());
+            }
+
+            for (size_t j = 0; j < update.size(); j++) {
+                out << pages[update[j]] << (j + 1 < update.size() ? ',' : '\n');
+            }
+        }
+    }
+
+    const bool registered = generator::add({.day = 5, .sizeUnit = "updates", .defaultSize = 200, .generate = generate});
+
+}
@@ -0,0 +1,77 @@
+#include "generator.h"
+
+#include <string>
+
+namespace {
+
+    using Grid = std::vector<std::string>;
+
+    constexpr int rowSteps[] = {-1, 0, 1, 0};
+    constexpr int colSteps[] = {0, 1, 0, -1};
+
+    /**
+     * Walks the guard from (row, col) facing up. Returns true once the guard leaves the map; on a loop,
+     * stores the obstruction hit last, so that removing it breaks the loop.
+     */
+    bool guardLeaves(const Grid &grid, int row, int col, int &obstructionRow, int &obstructionCol) {
+        auto size = static_cast<int>(grid.size());
+        std::vector<uint8_t> visited(grid.size() * grid.size(), 0);
+        int direction = 0;
+
+        while (true) {
+            auto &state = visited[static_cast<size_t>(row * size + col)];
+            if (state & (1 << direction)) {
+                return false;
+            }
+            state |= static_cast<uint8_t>(1 << direction);
+
+            int nextRow = row + rowSteps[direction];
+            int nextCol = col + colSteps[direction];
+            if (nextRow < 0 || nextCol < 0 || nextRow >= size || nextCol >= size) {
+                return true;
+            }
+            if (grid[nextRow][nextCol] == '#') {
+                obstructionRow = nextRow;
+                obstructionCol = nextCol;
+                direction = (direction + 1) % 4;
+            } else {
+                row = nextRow;
+                col = nextCol;
+            }
+        }
+    }
+
+    /**
+     * A square lab with sparse obstructions and the guard near the centre. Part 1 assumes the guard
+     * eventually walks off the map, so obstructions closing a loop are removed until it does.
+     */
+    void generate(std::ostream &out, uint64_t size, generator::Random &random) {
+        auto side = static_cast<int>(std::max<uint64_t>(size, 2));
+        Grid grid(side, std::string(side, '.'));
+        for (auto &row: grid) {
+            for (auto &field: row) {
+                if (random.chance(0.04)) {
+                    field = '#';
+                }
+            }
+        }
+
+        int guardRow = side / 2;
+        int guardCol = side / 2;
+        grid[guardRow][guardCol] = '.';
+
+        int obstructionRow = 0;
+        int obstructionCol = 0;
+        while (!guardLeaves(grid, guardRow, guardCol, obstructionRow, obstructionCol)) {
+            grid[obstructionRow][obstructionCol] = '.';
+        }
+
+        grid[guardRow][guardCol] = '^';
+        for (const auto &row: grid) {
+            out << row << '\n';
+        }
+    }
+
+    const bool registered = generator::add({.day = 6, .sizeUnit = "grid side length", .defaultSize = 130, .generate = generate});
+
+}
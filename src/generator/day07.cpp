@@ -0,0 +1,51 @@
+#include "generator.h"
+
+#include <string>
+
+namespace {
+
+    // Keeps results comfortably inside the long the solver parses them into.
+    constexpr int64_t resultLimit = 100'000'000'000'000;
+
+    int64_t concatenate(int64_t left, int64_t right) {
+        return std::stoll(std::to_string(left) + std::to_string(right));
+    }
+
+    /**
+     * Equations of 3 to 12 operands. The result is computed with random +, * and || operators,
+     * then a third of the results are shifted by one so that they are (almost certainly) unsolvable.
+     */
+    void generate(std::ostream &out, uint64_t size, generator::Random &random) {
+        for (uint64_t i = 0; i < size; i++) {
+            auto count = random.uniform(3, 12);
+            std::vector<int64_t> operands{};
+            for (int64_t j = 0; j < count; j++) {
+                operands.push_back(random.uniform(1, 999));
+            }
+
+            int64_t result = operands[0];
+            for (size_t j = 1; j < operands.size(); j++) {
+                auto roll = random.uniform(0, 2);
+                int64_t next = result + operands[j];
+                if (roll == 1 && result <= resultLimit / operands[j]) {
+                    next = result * operands[j];
+                } else if (roll == 2 && result < resultLimit / 1000) {
+                    next = concatenate(result, operands[j]);
+                }
+                result = next;
+            }
+            if (random.chance(1.0 / 3)) {
+                result += 1;
+            }
+
+            out << result << ':';
+            for (auto operand: operands) {
+                out << ' ' << operand;
+            }
+            out << '\n';
+        }
+    }
+
+    const bool registered = generator::add({.day = 7, .sizeUnit = "equations", .defaultSize = 850, .generate = generate});
+
+}
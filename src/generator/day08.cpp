@@ -0,0 +1,24 @@
+#include "generator.h"
+
+#include <string>
+
+namespace {
+
+    // A square map with about one antenna per 50 fields, of 62 possible frequencies.
+    void generate(std::ostream &out, uint64_t size, generator::Random &random) {
+        const std::string frequencies = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+        std::string row(size + 1, '\n');
+        for (uint64_t r = 0; r < size; r++) {
+            for (uint64_t c = 0; c < size; c++) {
+                row[c] = random.chance(0.02)
+                         ? frequencies[random.uniform(0, static_cast<int64_t>(frequencies.size()) - 1)]
+                         : '.';
+            }
+            out << row;
+        }
+    }
+
+    const bool registered = generator::add({.day = 8, .sizeUnit = "grid side length", .defaultSize = 50, .generate = generate});
+
+}
@@ -0,0 +1,18 @@
+#include "generator.h"
+
+#include <string>
+
+namespace {
+
+    // A dense disk map of `size` digits alternating file lengths (1-9) and free space (0-9).
+    void generate(std::ostream &out, uint64_t size, generator::Random &random) {
+        std::string digits(size, '0');
+        for (uint64_t i = 0; i < size; i++) {
+            digits[i] = static_cast<char>('0' + (i % 2 == 0 ? random.uniform(1, 9) : random.uniform(0, 9)));
+        }
+        out << digits << '\n';
+    }
+
+    const bool registered = generator::add({.day = 9, .sizeUnit = "digits", .defaultSize = 19999, .generate = generate});
+
+}
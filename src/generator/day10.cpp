@@ -0,0 +1,46 @@
+#include "generator.h"
+
+#include <string>
+
+namespace {
+
+    /**
+     * A square topographic map of random heights with hiking trails planted into it: random walks
+     * from a trailhead whose heights increase from 0 to 9 one step at a time.
+     */
+    void generate(std::ostream &out, uint64_t size, generator::Random &random) {
+        constexpr int rowSteps[] = {-1, 0, 1, 0};
+        constexpr int colSteps[] = {0, 1, 0, -1};
+
+        auto side = static_cast<int64_t>(size);
+        std::vector<std::string> map(size, std::string(size, '0'));
+        for (auto &row: map) {
+            for (auto &height: row) {
+                height = static_cast<char>('0' + random.uniform(1, 9));
+            }
+        }
+
+        for (uint64_t trail = 0; trail < size * size / 25; trail++) {
+            auto row = random.uniform(0, side - 1);
+            auto col = random.uniform(0, side - 1);
+            for (char height = '0'; height <= '9'; height++) {
+                map[row][col] = height;
+                auto direction = random.uniform(0, 3);
+                auto nextRow = row + rowSteps[direction];
+                auto nextCol = col + colSteps[direction];
+                if (nextRow < 0 || nextCol < 0 || nextRow >= side || nextCol >= side) {
+                    break;
+                }
+                row = nextRow;
+                col = nextCol;
+            }
+        }
+
+        for (const auto &row: map) {
+            out << row << '\n';
+        }
+    }
+
+    const bool registered = generator::add({.day = 10, .sizeUnit = "grid side length", .defaultSize = 60, .generate = generate});
+
+}
@@ -0,0 +1,14 @@
+#include "generator.h"
+
+namespace {
+
+    // Stones engraved with numbers of up to seven digits, on a single line.
+    void generate(std::ostream &out, uint64_t size, generator::Random &random) {
+        for (uint64_t i = 0; i < size; i++) {
+            out << random.uniform(0, 9'999'999) << (i + 1 < size ? ' ' : '\n');
+        }
+    }
+
+    const bool registered = generator::add({.day = 11, .sizeUnit = "stones", .defaultSize = 8, .generate = generate});
+
+}
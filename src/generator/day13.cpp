@@ -0,0 +1,39 @@
+#include "generator.h"
+
+namespace {
+
+    /**
+     * Claw machines with button offsets of 10-99. Half of the prizes are reachable with at most
+     * 100 presses of each button; the rest are placed at random.
+     */
+    void generate(std::ostream &out, uint64_t size, generator::Random &random) {
+        for (uint64_t i = 0; i < size; i++) {
+            auto ax = random.uniform(10, 99);
+            auto ay = random.uniform(10, 99);
+            auto bx = random.uniform(10, 99);
+            auto by = random.uniform(10, 99);
+
+            int64_t prizeX;
+            int64_t prizeY;
+            if (random.chance(0.5)) {
+                auto pressesA = random.uniform(0, 100);
+                auto pressesB = random.uniform(0, 100);
+                prizeX = pressesA * ax + pressesB * bx;
+                prizeY = pressesA * ay + pressesB * by;
+            } else {
+                prizeX = random.uniform(1000, 19999);
+                prizeY = random.uniform(1000, 19999);
+            }
+
+            if (i > 0) {
+                out << '\n';
+            }
+            out << "Button A: X+" << ax << ", Y+" << ay << '\n'
+                << "Button B: X+" << bx << ", Y+" << by << '\n'
+                << "Prize: X=" << prizeX << ", Y=" << prizeY << '\n';
+        }
+    }
+
+    const bool registered = generator::add({.day = 13, .sizeUnit = "machines", .defaultSize = 320, .generate = generate});
+
+}
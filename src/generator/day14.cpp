@@ -0,0 +1,42 @@
+#include "generator.h"
+
+namespace {
+
+    constexpr int64_t width = 101;
+    constexpr int64_t height = 103;
+
+    int64_t wrap(int64_t value, int64_t modulus) {
+        return ((value % modulus) + modulus) % modulus;
+    }
+
+    /**
+     * Robots in the fixed 101x103 area the solver assumes, with velocities of up to 99 per second.
+     * Part 2 runs until robots line up into a picture, so up to 31 of them are aimed to form
+     * a horizontal line at a random second within the period of the area.
+     */
+    void generate(std::ostream &out, uint64_t size, generator::Random &random) {
+        auto pictureRobots = static_cast<int64_t>(std::min<uint64_t>(size, 31));
+        auto pictureTime = random.uniform(1, width * height - 1);
+        auto pictureRow = random.uniform(0, height - 1);
+        auto pictureCol = random.uniform(0, width - pictureRobots);
+
+        for (int64_t i = 0; i < static_cast<int64_t>(size); i++) {
+            auto velocityX = random.uniform(-99, 99);
+            auto velocityY = random.uniform(-99, 99);
+
+            int64_t positionX;
+            int64_t positionY;
+            if (i < pictureRobots) {
+                positionX = wrap(pictureCol + i - velocityX * pictureTime, width);
+                positionY = wrap(pictureRow - velocityY * pictureTime, height);
+            } else {
+                positionX = random.uniform(0, width - 1);
+                positionY = random.uniform(0, height - 1);
+            }
+            out << "p=" << positionX << ',' << positionY << " v=" << velocityX << ',' << velocityY << '\n';
+        }
+    }
+
+    const bool registered = generator::add({.day = 14, .sizeUnit = "robots", .defaultSize = 500, .generate = generate});
+
+}
@@ -0,0 +1,52 @@
+#include "generator.h"
+
+#include <string>
+
+namespace {
+
+    /**
+     * An already widened warehouse of `size` rows and 2 * `size` columns with walls ("##"),
+     * boxes ("[]") and the robot, followed by 8 * size^2 moves in lines of 1000.
+     */
+    void generate(std::ostream &out, uint64_t size, generator::Random &random) {
+        constexpr char moves[] = {'<', '>', '^', 'v'};
+        constexpr uint64_t movesPerLine = 1000;
+
+        auto rows = std::max<uint64_t>(size, 4);
+        auto cells = rows;
+        std::vector<std::string> warehouse(rows, std::string(2 * cells, '.'));
+
+        for (uint64_t row = 0; row < rows; row++) {
+            for (uint64_t cell = 0; cell < cells; cell++) {
+                bool border = row == 0 || cell == 0 || row + 1 == rows || cell + 1 == cells;
+                if (border || random.chance(0.05)) {
+                    warehouse[row].replace(2 * cell, 2, "##");
+                } else if (random.chance(0.25)) {
+                    warehouse[row].replace(2 * cell, 2, "[]");
+                }
+            }
+        }
+        warehouse[rows / 2][cells] = '@';
+        warehouse[rows / 2][cells + 1] = '.';
+        warehouse[rows / 2][cells - 1] = '.';
+        warehouse[rows / 2][cells - 2] = '.';
+
+        for (const auto &row: warehouse) {
+            out << row << '\n';
+        }
+        out << '\n';
+
+        auto total = 8 * rows * rows;
+        std::string line{};
+        for (uint64_t i = 0; i < total; i++) {
+            line += moves[random.uniform(0, 3)];
+            if (line.size() == movesPerLine || i + 1 == total) {
+                out << line << '\n';
+                line.clear();
+            }
+        }
+    }
+
+    const bool registered = generator::add({.day = 15, .sizeUnit = "warehouse rows", .defaultSize = 50, .generate = generate});
+
+}
@@ -0,0 +1,69 @@
+#include "generator.h"
+
+#include <string>
+#include <utility>
+
+namespace {
+
+    /**
+     * A maze carved by an iterative depth-first search over the odd cells of a square grid, then
+     * braided by knocking out some of the remaining walls, so that there are many equally good paths.
+     * The start is in the bottom-left corner and the end in the top-right one, as in the puzzle.
+     */
+    void generate(std::ostream &out, uint64_t size, generator::Random &random) {
+        constexpr int rowSteps[] = {-2, 0, 2, 0};
+        constexpr int colSteps[] = {0, 2, 0, -2};
+
+        // The side has to be odd so that the maze is closed by walls on all sides.
+        auto side = static_cast<int>(std::max<uint64_t>(size, 5) | 1);
+        std::vector<std::string> maze(side, std::string(side, '#'));
+
+        std::vector<std::pair<int, int>> stack{{side - 2, 1}};
+        maze[side - 2][1] = '.';
+        std::vector<int> directions{0, 1, 2, 3};
+
+        while (!stack.empty()) {
+            auto [row, col] = stack.back();
+            random.shuffle(directions);
+
+            bool carved = false;
+            for (auto direction: directions) {
+                int nextRow = row + rowSteps[direction];
+                int nextCol = col + colSteps[direction];
+                if (nextRow <= 0 || nextCol <= 0 || nextRow >= side - 1 || nextCol >= side - 1) {
+                    continue;
+                }
+                if (maze[nextRow][nextCol] == '.') {
+                    continue;
+                }
+                maze[row + rowSteps[direction] / 2][col + colSteps[direction] / 2] = '.';
+                maze[nextRow][nextCol] = '.';
+                stack.emplace_back(nextRow, nextCol);
+                carved = true;
+                break;
+            }
+            if (!carved) {
+                stack.pop_back();
+            }
+        }
+
+        for (int row = 1; row < side - 1; row++) {
+            for (int col = 1; col < side - 1; col++) {
+                bool betweenRows = row % 2 == 0 && col % 2 == 1;
+                bool betweenCols = row % 2 == 1 && col % 2 == 0;
+                if ((betweenRows || betweenCols) && random.chance(0.05)) {
+                    maze[row][col] = '.';
+                }
+            }
+        }
+
+        maze[side - 2][1] = 'S';
+        maze[1][side - 2] = 'E';
+        for (const auto &row: maze) {
+            out << row << '\n';
+        }
+    }
+
+    const bool registered = generator::add({.day = 16, .sizeUnit = "maze side length", .defaultSize = 141, .generate = generate});
+
+}
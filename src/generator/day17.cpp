@@ -0,0 +1,32 @@
+#include "generator.h"
+
+#include <stdexcept>
+
+namespace {
+
+    // The solver divides register A by std::pow(2, operand) in double precision, which is exact
+    // while A stays below 2^53. A program that prints n values needs A below 8^n, so n <= 17.
+    constexpr uint64_t maxOutputs = 17;
+
+    /**
+     * A program of the same shape as the puzzle's (shift A by three bits per iteration, print one
+     * value derived from the low bits of A) with random operands, and an initial value of
+     * register A that makes it print `size` values.
+     */
+    void generate(std::ostream &out, uint64_t size, generator::Random &random) {
+        if (size < 1 || size > maxOutputs) {
+            throw std::invalid_argument("Day 17 supports 1 to 17 outputs");
+        }
+        auto registerA = random.uniform(int64_t{1} << (3 * (size - 1)), (int64_t{1} << (3 * size)) - 1);
+
+        out << "Register A: " << registerA << '\n'
+            << "Register B: 0\n"
+            << "Register C: 0\n"
+            << '\n'
+            << "Program: 2,4,1," << random.uniform(0, 7) << ",7,5,0,3,4,7,1," << random.uniform(0, 7) << ",5,5,3,0";
+    }
+
+    const bool registered = generator::add({.day = 17, .sizeUnit = "output values", .defaultSize = 9, .generate = generate,
+                                            .maxSize = maxOutputs});
+
+}
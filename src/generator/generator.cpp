@@ -0,0 +1,54 @@
+
+#include "generator.h"
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+    std::vector<generator::Generator> &registry() {
+        static std::vector<generator::Generator> generators{};
+        return generators;
+    }
+
+}
+
+namespace generator {
+
+    bool add(Generator generator) {
+        registry().push_back(std::move(generator));
+        return true;
+    }
+
+    std::vector<Generator> generators() {
+        auto sorted = registry();
+        std::sort(sorted.begin(), sorted.end(), [](const Generator &a, const Generator &b) {
+            return a.day < b.day;
+        });
+        return sorted;
+    }
+
+    const Generator &find(int day) {
+        const auto &generators = registry();
+        auto it = std::find_if(generators.begin(), generators.end(), [day](const Generator &generator) {
+            return generator.day == day;
+        });
+        if (it == generators.end()) {
+            throw std::invalid_argument("No generator for day " + std::to_string(day));
+        }
+        return *it;
+    }
+
+    void generate(int day, std::ostream &out, uint64_t size, uint64_t seed) {
+        Random random(seed);
+        find(day).generate(out, size, random);
+    }
+
+    std::string generate(int day, uint64_t size, uint64_t seed) {
+        std::ostringstream out{};
+        generate(day, out, size, seed);
+        return out.str();
+    }
+
+}
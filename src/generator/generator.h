@@ -0,0 +1,94 @@
+
+#ifndef AOC_2023_GENERATOR_H
+#define AOC_2023_GENERATOR_H
+
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * Synthetic puzzle inputs at configurable scale. Every day registers a generator that writes
+ * an input in the same format as input_files/dayNN.txt. Output depends only on (size, seed).
+ */
+namespace generator {
+
+    /**
+     * Deterministic random numbers. std::mt19937_64 produces the same sequence everywhere, but the
+     * standard distributions do not, so the ranges are derived from the raw engine output here.
+     */
+    class Random {
+    public:
+        explicit Random(uint64_t seed) : m_engine(seed) {
+        }
+
+        uint64_t next() {
+            return m_engine();
+        }
+
+        /**
+         * Uniform integer in [min, max].
+         */
+        int64_t uniform(int64_t min, int64_t max) {
+            auto range = static_cast<unsigned __int128>(static_cast<uint64_t>(max - min)) + 1;
+            auto scaled = (static_cast<unsigned __int128>(next()) * range) >> 64;
+            return min + static_cast<int64_t>(scaled);
+        }
+
+        bool chance(double probability) {
+            return static_cast<double>(next() >> 11) * 0x1.0p-53 < probability;
+        }
+
+        template<typename T>
+        const T &pick(const std::vector<T> &values) {
+            return values[uniform(0, static_cast<int64_t>(values.size()) - 1)];
+        }
+
+        template<typename T>
+        void shuffle(std::vector<T> &values) {
+            for (size_t i = values.size(); i > 1; i--) {
+                std::swap(values[i - 1], values[uniform(0, static_cast<int64_t>(i) - 1)]);
+            }
+        }
+
+    private:
+        std::mt19937_64 m_engine;
+    };
+
+    using GenerateFunction = std::function<void(std::ostream &out, uint64_t size, Random &random)>;
+
+    struct Generator {
+        int day{};
+        // What the size parameter means for this day, e.g. "lines" or "maze side length".
+        std::string sizeUnit;
+        // Produces an input of roughly the size of the puzzle input.
+        uint64_t defaultSize{};
+        GenerateFunction generate;
+        // Largest size the day's solver can parse.
+        uint64_t maxSize = UINT64_MAX;
+    };
+
+    /**
+     * Returns true so that it can initialize a namespace-scope constant in the generator's source.
+     */
+    bool add(Generator generator);
+
+    /**
+     * Registered generators ordered by day.
+     */
+    std::vector<Generator> generators();
+
+    /**
+     * Throws std::invalid_argument when the day has no generator.
+     */
+    const Generator &find(int day);
+
+    void generate(int day, std::ostream &out, uint64_t size, uint64_t seed);
+
+    std::string generate(int day, uint64_t size, uint64_t seed);
+
+}
+
+#endif
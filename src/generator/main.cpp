@@ -0,0 +1,100 @@
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "generator.h"
+
+namespace {
+
+struct InputArgs {
+    int day{};
+    uint64_t size{};
+    bool hasSize;
+    uint64_t seed{1};
+    std::string outputPath;
+    bool list;
+    bool areInvalid;
+};
+
+void printUsage() {
+    std::cout << "Usage: aoc_generate <day> [--size=N] [--seed=N] [--output=FILE]\n"
+                 "       aoc_generate --list\n";
+}
+
+InputArgs parseArguments(int argc, char *argv[]) {
+    InputArgs args{};
+    try {
+        for (int i = 1; i < argc; i++) {
+            std::string_view arg{argv[i]};
+            auto value = [&arg]() {
+                return std::string(arg.substr(arg.find('=') + 1));
+            };
+
+            if (arg.starts_with("--size=")) {
+                args.size = std::stoull(value());
+                args.hasSize = true;
+            } else if (arg.starts_with("--seed=")) {
+                args.seed = std::stoull(value());
+            } else if (arg.starts_with("--output=")) {
+                args.outputPath = value();
+            } else if (arg == "--list") {
+                args.list = true;
+            } else if (!arg.starts_with("--") && args.day == 0) {
+                args.day = std::stoi(std::string(arg));
+            } else {
+                args.areInvalid = true;
+            }
+        }
+    } catch (...) {
+        args.areInvalid = true;
+    }
+    if (!args.list && args.day == 0) {
+        args.areInvalid = true;
+    }
+    return args;
+}
+
+void printGenerators() {
+    for (const auto &generator: generator::generators()) {
+        std::cout << "day" << (generator.day < 10 ? "0" : "") << generator.day
+                  << "  size = " << generator.sizeUnit << " (default " << generator.defaultSize << ")\n";
+    }
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+    InputArgs args{parseArguments(argc, argv)};
+    if (args.areInvalid) {
+        std::cout << "Input arguments are invalid." << std::endl;
+        printUsage();
+        return EXIT_FAILURE;
+    }
+    if (args.list) {
+        printGenerators();
+        return EXIT_SUCCESS;
+    }
+
+    try {
+        const auto &generator = generator::find(args.day);
+        auto size = args.hasSize ? args.size : generator.defaultSize;
+
+        if (args.outputPath.empty()) {
+            generator::generate(args.day, std::cout, size, args.seed);
+        } else {
+            std::ofstream output(args.outputPath, std::ios::binary);
+            if (!output) {
+                std::cerr << "Failed to open " << args.outputPath << std::endl;
+                return EXIT_FAILURE;
+            }
+            generator::generate(args.day, output, size, args.seed);
+        }
+    } catch (const std::exception &exception) {
+        std::cerr << exception.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
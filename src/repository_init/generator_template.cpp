@@ -0,0 +1,17 @@
+#include "generator.h"
+
+namespace {
+
+    /**
+     * `size` lines of random numbers. Replace with the format of input_files/DAY_NAME.txt, so that
+     * the scaling study of aoc_bench and the differential tests can feed the solver.
+     */
+    void generate(std::ostream &out, uint64_t size, generator::Random &random) {
+        for (uint64_t i = 0; i < size; i++) {
+            out << random.uniform(0, 99999) << '\n';
+        }
+    }
+
+    const bool registered = generator::add({.day = DAY_NUMBER, .sizeUnit = "lines", .defaultSize = 1000, .generate = generate});
+
+}
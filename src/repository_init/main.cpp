@@ -1,14 +1,27 @@
 
 #include <cstdlib>
 #include <filesystem>
-#include <format>
 #include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <iterator>
+#include <optional>
+#include <sstream>
+#include <string>
 
 namespace fs = std::filesystem;
 
 namespace {
 
+/**
+ * "day05" for day 5.
+ */
+std::string dayName(int dayNumber) {
+    std::ostringstream name{};
+    name << "day" << std::setw(2) << std::setfill('0') << dayNumber;
+    return name.str();
+}
+
 struct InputArgs {
     std::string argv0;
     int startDay;
@@ -38,8 +51,11 @@ class TemplateHandler {
     TemplateHandler(std::string_view argv0)
         : executablePath(getExecutablePath(argv0)) {}
 
-    fs::path getTemplatePath() const {
-        return executablePath / "main_template.cpp";
+    /**
+     * The templates are copied next to the executable by the build.
+     */
+    fs::path getTemplatePath(std::string_view fileName) const {
+        return executablePath / fileName;
     }
 
    private:
@@ -60,26 +76,35 @@ class FileCreator {
 
     void createEmptyInputFiles(int firstDay, int lastDay) const {
         auto folderPath = rootPath / "input_files";
-        constexpr auto fileNameFormat = "day{:02}.txt";
-
         for (int i = firstDay; i <= lastDay; ++i) {
-            std::string fileName = std::format(fileNameFormat, i);
-            createEmptyFile(folderPath, fileName);
+            createEmptyFile(folderPath, dayName(i) + ".txt");
         }
     }
 
+    /**
+     * Creates the solver and main() of every day in src/dayNN and its input generator in
+     * src/generator/dayNN.cpp. The build picks up the new files on its next run, as
+     * src/CMakeLists.txt and src/generator/CMakeLists.txt glob for them.
+     */
     void createSourceFilesFromTemplate(
         int firstDay, int lastDay,
         const TemplateHandler& templateHandler) const {
-        auto templatePath = templateHandler.getTemplatePath();
-        if (!fs::exists(templatePath)) {
-            std::cerr << "Template file does not exist: " << templatePath
-                      << std::endl;
-            return;
+        auto solverTemplatePath =
+            templateHandler.getTemplatePath("solver_template.cpp");
+        auto generatorTemplatePath =
+            templateHandler.getTemplatePath("generator_template.cpp");
+        for (const auto& templatePath :
+             {solverTemplatePath, generatorTemplatePath}) {
+            if (!fs::exists(templatePath)) {
+                std::cerr << "Template file does not exist: " << templatePath
+                          << std::endl;
+                return;
+            }
         }
 
         for (int i = firstDay; i <= lastDay; ++i) {
-            createSourceFileFromTemplate(i, templatePath);
+            createSourceFileFromTemplate(i, solverTemplatePath);
+            createGeneratorFileFromTemplate(i, generatorTemplatePath);
         }
     }
 
@@ -103,20 +128,72 @@ class FileCreator {
 
     void createSourceFileFromTemplate(int dayNumber,
                                       const fs::path& templatePath) const {
-        auto targetDirPath = rootPath / std::format("src/day{:02}", dayNumber);
-        auto targetFilePath = targetDirPath / "main.cpp";
+        auto targetDirPath = rootPath / "src" / dayName(dayNumber);
+        auto solverFilePath = targetDirPath / "solver.cpp";
+        auto mainFilePath = targetDirPath / "main.cpp";
 
         try {
             fs::create_directories(targetDirPath);
-            fs::copy_file(templatePath, targetFilePath,
-                          fs::copy_options::skip_existing);
-            std::cout << "Template copied to: " << targetFilePath << std::endl;
+            if (!fs::exists(solverFilePath)) {
+                std::ofstream solverFile(solverFilePath);
+                solverFile << instantiateTemplate(templatePath, dayNumber);
+                std::cout << "Template copied to: " << solverFilePath << std::endl;
+            }
+            if (!fs::exists(mainFilePath)) {
+                std::ofstream mainFile(mainFilePath);
+                mainFile << "#include \"solver.h\"\n"
+                            "\n"
+                            "int main(int argc, char *argv[]) {\n"
+                            "    return solver::runDay("
+                         << dayNumber
+                         << ", argc, argv);\n"
+                            "}\n";
+                std::cout << "Created file: " << mainFilePath << std::endl;
+            }
         } catch (const fs::filesystem_error& e) {
             std::cerr << "Filesystem error: " << e.what() << std::endl;
         } catch (const std::exception& e) {
             std::cerr << "Error: " << e.what() << std::endl;
         }
     }
+
+    void createGeneratorFileFromTemplate(int dayNumber,
+                                         const fs::path& templatePath) const {
+        auto generatorFilePath =
+            rootPath / "src" / "generator" / (dayName(dayNumber) + ".cpp");
+        if (fs::exists(generatorFilePath)) {
+            return;
+        }
+        std::ofstream generatorFile(generatorFilePath);
+        if (!generatorFile) {
+            std::cerr << "Failed to create file: " << generatorFilePath << '\n';
+            return;
+        }
+        generatorFile << instantiateTemplate(templatePath, dayNumber);
+        std::cout << "Template copied to: " << generatorFilePath << std::endl;
+    }
+
+    /**
+     * Replaces DAY_NAME (e.g. day05) and DAY_NUMBER (e.g. 5) in the solver template.
+     */
+    static std::string instantiateTemplate(const fs::path& templatePath,
+                                           int dayNumber) {
+        std::ifstream templateFile(templatePath);
+        std::string content((std::istreambuf_iterator<char>(templateFile)),
+                            std::istreambuf_iterator<char>());
+
+        auto replaceAll = [&content](const std::string& placeholder,
+                                     const std::string& value) {
+            for (auto position = content.find(placeholder);
+                 position != std::string::npos;
+                 position = content.find(placeholder, position + value.size())) {
+                content.replace(position, placeholder.size(), value);
+            }
+        };
+        replaceAll("DAY_NAME", dayName(dayNumber));
+        replaceAll("DAY_NUMBER", std::to_string(dayNumber));
+        return content;
+    }
 };
 
 std::optional<fs::path> navigateToParentDirectory(
@@ -0,0 +1,76 @@
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include <numeric>
+#include <limits>
+#include <optional>
+#include "arena.h"
+#include "differential.h"
+#include "input.h"
+#include "print.h"
+#include "array2d.h"
+#include "profiling.h"
+#include "solver.h"
+
+
+namespace DAY_NAME {
+
+    struct Input {
+
+    };
+
+    Input parseInput(std::string_view text) {
+        AOC_PROFILE_ZONE("DAY_NAME parse");
+        // The lines are scratch, only the input is kept.
+        auto lines = input::splitLines(text, arena::current());
+        Input input{};
+
+        return input;
+    }
+
+}
+
+namespace DAY_NAME::part1 {
+
+    solver::Answer execute(const Input &input) {
+        AOC_PROFILE_ZONE("DAY_NAME part 1");
+        return {};
+    }
+}
+
+namespace DAY_NAME::part2 {
+
+    solver::Answer execute(const Input &input) {
+        AOC_PROFILE_ZONE("DAY_NAME part 2");
+        return {};
+    }
+}
+
+namespace DAY_NAME {
+    struct Solver {
+        using Input = DAY_NAME::Input;
+
+        static Input parse(std::string_view text) {
+            return parseInput(text);
+        }
+
+        static solver::Answer part1(const Input &input) {
+            return DAY_NAME::part1::execute(input);
+        }
+
+        static solver::Answer part2(const Input &input) {
+            return DAY_NAME::part2::execute(input);
+        }
+    };
+
+    // Registered days are also benchmarked by aoc_bench and batched by aoc_runner.
+    const bool registered = solver::registerSolver<Solver>(DAY_NUMBER);
+
+    // When a part gets a faster implementation, keep the straightforward one as its oracle
+    // (see differential.h):
+    // const bool checked = differential::registerCheck<Solver>(DAY_NUMBER, 1, "execute", part1::executeReference,
+    //                                                          part1::execute);
+}
@@ -0,0 +1,290 @@
+
+#include "batch.h"
+
+#include <algorithm>
+#include <exception>
+#include <filesystem>
+#include <iomanip>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+
+#include <tbb/concurrent_queue.h>
+#include <tbb/global_control.h>
+#include <tbb/parallel_pipeline.h>
+
+#include "cache.h"
+#include "input.h"
+#include "json.h"
+#include "output_silencer.h"
+#include "runner.h"
+#include "solver.h"
+#include "timer.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+    struct Item {
+        size_t index{};
+        std::string path;
+        std::string text;
+        cache::Key key;
+        solver::ParsedInput input;
+        runner::Stage read;
+        runner::Stage parse;
+        runner::Stage part1;
+        runner::Stage part2;
+        solver::Answer answer1;
+        solver::Answer answer2;
+    };
+
+    /**
+     * Recycles input buffers between items, so that reading reuses their capacity instead of
+     * allocating a buffer per input. Holds at most one buffer per token.
+     */
+    class BufferPool {
+    public:
+        std::string acquire() {
+            std::string buffer{};
+            m_buffers.try_pop(buffer);
+            return buffer;
+        }
+
+        void release(std::string &&buffer) {
+            buffer.clear();
+            m_buffers.push(std::move(buffer));
+        }
+
+    private:
+        tbb::concurrent_queue<std::string> m_buffers;
+    };
+
+    template<typename Function>
+    void runStage(runner::Stage &stage, Function function) {
+        Timer timer;
+        try {
+            function();
+            stage.seconds = timer.elapsed();
+            stage.done = true;
+        } catch (const std::exception &exception) {
+            stage.error = exception.what();
+        }
+    }
+
+    std::string firstError(const Item &item) {
+        for (const auto *stage: {&item.read, &item.parse, &item.part1, &item.part2}) {
+            if (!stage->error.empty()) {
+                return stage->error;
+            }
+        }
+        return {};
+    }
+
+    std::string milliseconds(const runner::Stage &stage) {
+        if (!stage.done) {
+            return "";
+        }
+        if (stage.cached) {
+            return "cached";
+        }
+        std::ostringstream oss{};
+        oss << std::fixed << std::setprecision(3) << stage.seconds * 1e3;
+        return oss.str();
+    }
+
+    std::string quoteCsv(const std::string &string) {
+        if (string.find_first_of(",\"\r\n") == std::string::npos) {
+            return string;
+        }
+        std::string quoted = "\"";
+        for (char character: string) {
+            if (character == '"') {
+                quoted.push_back('"');
+            }
+            quoted.push_back(character);
+        }
+        return quoted + "\"";
+    }
+
+    class Emitter {
+    public:
+        Emitter(std::ostream &out, batch::Format format) : m_out(out), m_format(format) {
+            if (m_format == batch::Format::Csv) {
+                m_out << "file,part1,part2,read_ms,parse_ms,part1_ms,part2_ms,error\n";
+            } else {
+                m_out << "[";
+            }
+        }
+
+        ~Emitter() {
+            if (m_format == batch::Format::Json) {
+                m_out << (m_first ? "]\n" : "\n]\n");
+            }
+            m_out.flush();
+        }
+
+        void emit(const Item &item) {
+            if (m_format == batch::Format::Csv) {
+                m_out << quoteCsv(item.path) << ',' << quoteCsv(item.answer1.value) << ','
+                      << quoteCsv(item.answer2.value) << ',' << milliseconds(item.read) << ','
+                      << milliseconds(item.parse) << ',' << milliseconds(item.part1) << ','
+                      << milliseconds(item.part2) << ',' << quoteCsv(firstError(item)) << '\n';
+                return;
+            }
+            m_out << (m_first ? "\n" : ",\n");
+            m_out << "  {\"file\": " << json::quote(item.path)
+                  << ", \"part1\": " << json::quote(item.answer1.value)
+                  << ", \"part2\": " << json::quote(item.answer2.value);
+            for (const auto &[name, stage]: {std::pair{"read_ms", &item.read}, std::pair{"parse_ms", &item.parse},
+                                             std::pair{"part1_ms", &item.part1}, std::pair{"part2_ms", &item.part2}}) {
+                if (stage->cached) {
+                    m_out << ", \"" << name << "\": \"cached\"";
+                } else if (stage->done) {
+                    m_out << ", \"" << name << "\": " << milliseconds(*stage);
+                }
+            }
+            auto error = firstError(item);
+            if (!error.empty()) {
+                m_out << ", \"error\": " << json::quote(error);
+            }
+            m_out << "}";
+            m_first = false;
+        }
+
+    private:
+        std::ostream &m_out;
+        batch::Format m_format;
+        bool m_first = true;
+    };
+
+}
+
+namespace batch {
+
+    std::vector<std::string> listInputs(const std::string &inputs) {
+        std::vector<std::string> paths{};
+
+        if (fs::is_directory(inputs)) {
+            for (const auto &entry: fs::directory_iterator(inputs)) {
+                if (entry.is_regular_file()) {
+                    paths.push_back(entry.path().string());
+                }
+            }
+            std::sort(paths.begin(), paths.end());
+            return paths;
+        }
+
+        auto base = fs::path(inputs).parent_path();
+        for (auto line: input::splitLines(solver::readInput(inputs))) {
+            input::trim(line);
+            if (line.empty() || line.starts_with('#')) {
+                continue;
+            }
+            auto path = fs::path(line);
+            paths.push_back((path.is_relative() ? base / path : path).string());
+        }
+        return paths;
+    }
+
+    Summary run(const Options &options, std::ostream &out) {
+        const auto &solver = solver::find(options.day);
+        auto paths = listInputs(options.inputs);
+        bool runPart2 = !solver.options.slowPart2 || options.includeSlow;
+        auto store = options.useCache ? cache::Store::open() : std::nullopt;
+        auto workers = tbb::global_control::active_value(tbb::global_control::max_allowed_parallelism);
+        size_t tokens = options.tokens > 0 ? options.tokens : 2 * workers;
+
+        Summary summary{.inputs = paths.size()};
+        BufferPool buffers{};
+        Emitter emitter(out, options.format);
+        size_t next = 0;
+
+        // Solvers' diagnostics would corrupt the records when they go to stdout.
+        std::optional<OutputSilencer> silencer{};
+        if (!options.verbose) {
+            silencer.emplace();
+        }
+        Timer wallTimer;
+
+        tbb::parallel_pipeline(
+                tokens,
+                tbb::make_filter<void, std::shared_ptr<Item>>(
+                        tbb::filter_mode::serial_in_order,
+                        [&](tbb::flow_control &control) -> std::shared_ptr<Item> {
+                            if (next == paths.size()) {
+                                control.stop();
+                                return nullptr;
+                            }
+                            auto item = std::make_shared<Item>();
+                            item->index = next;
+                            item->path = paths[next++];
+                            return item;
+                        }) &
+                tbb::make_filter<std::shared_ptr<Item>, std::shared_ptr<Item>>(
+                        tbb::filter_mode::parallel,
+                        [&](std::shared_ptr<Item> item) {
+                            item->text = buffers.acquire();
+                            runStage(item->read, [&]() {
+                                solver::readInput(item->path, item->text);
+                                item->key = cache::makeKey(solver, 1, item->text);
+                            });
+                            return item;
+                        }) &
+                tbb::make_filter<std::shared_ptr<Item>, std::shared_ptr<Item>>(
+                        tbb::filter_mode::parallel,
+                        [&](std::shared_ptr<Item> item) {
+                            if (item->read.done) {
+                                auto key2 = item->key;
+                                key2.part = 2;
+                                bool solvePart1 = !runner::findCached(store, item->key, item->part1, item->answer1);
+                                bool solvePart2 = runPart2 &&
+                                                  !runner::findCached(store, key2, item->part2, item->answer2);
+                                if (solvePart1 || solvePart2) {
+                                    runStage(item->parse, [&]() { item->input = solver.parse(item->text); });
+                                }
+                            }
+                            buffers.release(std::move(item->text));
+                            return item;
+                        }) &
+                tbb::make_filter<std::shared_ptr<Item>, std::shared_ptr<Item>>(
+                        tbb::filter_mode::parallel,
+                        [&](std::shared_ptr<Item> item) {
+                            if (item->parse.done && !item->part1.done) {
+                                runStage(item->part1, [&]() { item->answer1 = solver.part1(item->input); });
+                                if (item->part1.done && store) {
+                                    store->save(item->key, item->answer1);
+                                }
+                            }
+                            return item;
+                        }) &
+                tbb::make_filter<std::shared_ptr<Item>, std::shared_ptr<Item>>(
+                        tbb::filter_mode::parallel,
+                        [&](std::shared_ptr<Item> item) {
+                            if (item->parse.done && runPart2 && !item->part2.done) {
+                                runStage(item->part2, [&]() { item->answer2 = solver.part2(item->input); });
+                                if (item->part2.done && store) {
+                                    auto key2 = item->key;
+                                    key2.part = 2;
+                                    store->save(key2, item->answer2);
+                                }
+                            }
+                            // The parsed input is not needed anymore, release it before the item waits for its turn.
+                            item->input.reset();
+                            return item;
+                        }) &
+                tbb::make_filter<std::shared_ptr<Item>, void>(
+                        tbb::filter_mode::serial_in_order,
+                        [&](std::shared_ptr<Item> item) {
+                            if (!firstError(*item).empty()) {
+                                summary.failed++;
+                            }
+                            emitter.emit(*item);
+                        }));
+
+        summary.wallSeconds = wallTimer.elapsed();
+        return summary;
+    }
+
+}
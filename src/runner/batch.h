@@ -0,0 +1,47 @@
+
+#ifndef AOC_2023_BATCH_H
+#define AOC_2023_BATCH_H
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * Batch mode of aoc_runner: solves many inputs of one day. The inputs stream through a bounded
+ * TBB pipeline read -> parse -> part 1 -> part 2 -> emit. At most `tokens` inputs are in flight,
+ * so reading stalls while the solvers are behind and memory stays bounded.
+ */
+namespace batch {
+
+    enum class Format { Csv, Json };
+
+    struct Options {
+        int day{};
+        // A directory (every regular file in it, sorted by name) or a manifest listing one input path
+        // per line. Relative paths in a manifest are relative to the manifest, '#' starts a comment.
+        std::string inputs;
+        Format format = Format::Csv;
+        // Inputs in flight, 0 means twice the number of worker threads.
+        size_t tokens = 0;
+        bool includeSlow = false;
+        bool verbose = false;
+        bool useCache = true;
+    };
+
+    std::vector<std::string> listInputs(const std::string &inputs);
+
+    struct Summary {
+        size_t inputs{};
+        size_t failed{};
+        double wallSeconds{};
+    };
+
+    /**
+     * Writes one record per input, in the order of the inputs, as soon as it is solved.
+     */
+    Summary run(const Options &options, std::ostream &out);
+
+}
+
+#endif
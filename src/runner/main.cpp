@@ -0,0 +1,142 @@
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <tbb/global_control.h>
+
+#include "batch.h"
+#include "input.h"
+#include "profiling.h"
+#include "runner.h"
+#include "scheduler.h"
+
+namespace {
+
+struct InputArgs {
+    runner::Options options;
+    bool deterministic;
+    bool batch;
+    batch::Options batchOptions;
+    std::string outputPath;
+    bool areInvalid;
+};
+
+void printUsage() {
+    std::cout << "Usage: aoc_runner [--days=1,2,5] [--input-dir=DIR] [--threads=N] [--include-slow] [--verbose]\n"
+                 "                  [--deterministic] [--no-cache]\n"
+                 "       aoc_runner --batch=DAY --inputs=DIR|MANIFEST [--format=csv|json] [--output=FILE]\n"
+                 "                  [--tokens=N] [--threads=N] [--include-slow] [--verbose] [--deterministic]\n"
+                 "                  [--no-cache]\n";
+}
+
+InputArgs parseArguments(int argc, char *argv[]) {
+    InputArgs args{};
+    try {
+        for (int i = 1; i < argc; i++) {
+            std::string_view arg{argv[i]};
+            auto value = [&arg]() {
+                return std::string(arg.substr(arg.find('=') + 1));
+            };
+
+            if (arg.starts_with("--days=")) {
+                args.options.days = input::parseVector<int>(value(), ',');
+            } else if (arg.starts_with("--input-dir=")) {
+                args.options.inputDirectory = value();
+            } else if (arg.starts_with("--threads=")) {
+                args.options.threads = std::stoi(value());
+            } else if (arg == "--include-slow") {
+                args.options.includeSlow = true;
+            } else if (arg.starts_with("--batch=")) {
+                args.batch = true;
+                args.batchOptions.day = std::stoi(value());
+            } else if (arg.starts_with("--inputs=")) {
+                args.batchOptions.inputs = value();
+            } else if (arg == "--format=csv") {
+                args.batchOptions.format = batch::Format::Csv;
+            } else if (arg == "--format=json") {
+                args.batchOptions.format = batch::Format::Json;
+            } else if (arg.starts_with("--output=")) {
+                args.outputPath = value();
+            } else if (arg.starts_with("--tokens=")) {
+                args.batchOptions.tokens = std::stoul(value());
+            } else if (arg == "--verbose") {
+                args.options.verbose = true;
+            } else if (arg == "--deterministic") {
+                args.deterministic = true;
+            } else if (arg == "--no-cache") {
+                args.options.useCache = false;
+            } else {
+                args.areInvalid = true;
+            }
+        }
+    } catch (...) {
+        args.areInvalid = true;
+    }
+    if (args.options.threads < 0 || (args.batch && args.batchOptions.inputs.empty())) {
+        args.areInvalid = true;
+    }
+    args.batchOptions.includeSlow = args.options.includeSlow;
+    args.batchOptions.verbose = args.options.verbose;
+    args.batchOptions.useCache = args.options.useCache;
+    return args;
+}
+
+int runBatch(const InputArgs &args) {
+    // Opened before the batch silences stdout, so that the records still reach it. Appending, so that
+    // reopening stdout does not truncate a file it was redirected to with >>.
+    std::ofstream out = args.outputPath.empty() ? std::ofstream("/dev/stdout", std::ios::app)
+                                                : std::ofstream(args.outputPath);
+    if (!out) {
+        std::cerr << "Failed to open " << args.outputPath << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::unique_ptr<tbb::global_control> parallelism{};
+    if (args.options.threads > 0) {
+        parallelism = std::make_unique<tbb::global_control>(tbb::global_control::max_allowed_parallelism,
+                                                            args.options.threads);
+    }
+    auto summary = batch::run(args.batchOptions, out);
+
+    std::cerr << "Solved " << summary.inputs - summary.failed << " of " << summary.inputs << " inputs in "
+              << summary.wallSeconds * 1e3 << " ms";
+    if (summary.wallSeconds > 0.0) {
+        std::cerr << " (" << static_cast<double>(summary.inputs) / summary.wallSeconds << " inputs/s)";
+    }
+    std::cerr << std::endl;
+    return summary.failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+    InputArgs args{parseArguments(argc, argv)};
+    if (args.areInvalid) {
+        std::cout << "Input arguments are invalid." << std::endl;
+        printUsage();
+        return EXIT_FAILURE;
+    }
+
+    profiling::calibrateCounter();
+
+    // The solvers' own parallel loops follow the same limit as the harness, AOC_THREADS without --threads.
+    scheduler::configure({.concurrency = args.options.threads > 0 ? args.options.threads
+                                                                  : scheduler::options().concurrency,
+                          .deterministic = args.deterministic || scheduler::options().deterministic});
+
+    try {
+        if (args.batch) {
+            return runBatch(args);
+        }
+        auto report = runner::run(args.options);
+        runner::printReport(std::cout, report);
+    } catch (const std::exception &exception) {
+        std::cerr << exception.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,200 @@
+
+#include "runner.h"
+
+#include <algorithm>
+#include <exception>
+#include <iomanip>
+#include <memory>
+#include <optional>
+#include <sstream>
+
+#include <tbb/task_arena.h>
+#include <tbb/task_group.h>
+
+#include "output_silencer.h"
+#include "timer.h"
+
+namespace {
+
+    /**
+     * Runs the function as the given stage. Returns false when it threw, so that the stages
+     * depending on it are skipped.
+     */
+    template<typename Function>
+    bool runStage(runner::Stage &stage, Function function) {
+        Timer timer;
+        try {
+            function();
+            stage.seconds = timer.elapsed();
+            stage.done = true;
+        } catch (const std::exception &exception) {
+            stage.error = exception.what();
+        }
+        return stage.done;
+    }
+
+    std::vector<int> selectDays(const runner::Options &options) {
+        if (!options.days.empty()) {
+            return options.days;
+        }
+        std::vector<int> days{};
+        for (const auto &day: solver::days()) {
+            days.push_back(day.day);
+        }
+        return days;
+    }
+
+    std::string formatStage(const runner::Stage &stage) {
+        if (!stage.error.empty()) {
+            return "failed";
+        }
+        if (stage.cached) {
+            return "cached";
+        }
+        if (!stage.done) {
+            return "-";
+        }
+        std::ostringstream oss{};
+        oss << std::fixed << std::setprecision(3) << stage.seconds * 1e3;
+        return oss.str();
+    }
+
+    double stageSeconds(const runner::DayResult &result) {
+        return result.read.seconds + result.parse.seconds + result.part1.seconds + result.part2.seconds;
+    }
+
+}
+
+namespace runner {
+
+    bool findCached(const std::optional<cache::Store> &store, const cache::Key &key, Stage &stage,
+                    solver::Answer &answer) {
+        if (!store) {
+            return false;
+        }
+        Timer timer;
+        auto cached = store->find(key);
+        if (!cached) {
+            return false;
+        }
+        answer = std::move(*cached);
+        stage.seconds = timer.elapsed();
+        stage.done = true;
+        stage.cached = true;
+        return true;
+    }
+
+    Report run(const Options &options) {
+        auto days = selectDays(options);
+
+        Report report{};
+        report.days.resize(days.size());
+        for (size_t i = 0; i < days.size(); i++) {
+            report.days[i].day = days[i];
+        }
+
+        // Unknown days fail here rather than inside a task.
+        std::vector<const solver::Day *> solvers{};
+        for (auto day: days) {
+            solvers.push_back(&solver::find(day));
+        }
+
+        auto store = options.useCache ? cache::Store::open() : std::nullopt;
+
+        std::optional<OutputSilencer> silencer{};
+        if (!options.verbose) {
+            silencer.emplace();
+        }
+
+        tbb::task_arena arena(options.threads > 0 ? options.threads : tbb::task_arena::automatic);
+        Timer wallTimer;
+
+        arena.execute([&]() {
+            tbb::task_group group{};
+
+            for (size_t i = 0; i < solvers.size(); i++) {
+                group.run([&, i]() {
+                    const auto &solver = *solvers[i];
+                    auto &result = report.days[i];
+
+                    std::string text{};
+                    cache::Key key{};
+                    auto path = options.inputDirectory + "/" + solver::inputFileName(solver.day);
+                    if (!runStage(result.read, [&]() {
+                        text = solver::readInput(path);
+                        key = cache::makeKey(solver, 1, text);
+                    })) {
+                        return;
+                    }
+
+                    bool runPart2 = !solver.options.slowPart2 || options.includeSlow;
+                    auto key2 = key;
+                    key2.part = 2;
+                    bool solvePart1 = !findCached(store, key, result.part1, result.answer1);
+                    bool solvePart2 = runPart2 && !findCached(store, key2, result.part2, result.answer2);
+                    if (!solvePart1 && !solvePart2) {
+                        return;
+                    }
+
+                    auto input = std::make_shared<solver::ParsedInput>();
+                    if (!runStage(result.parse, [&]() { *input = solver.parse(text); })) {
+                        return;
+                    }
+
+                    // The parts are independent of each other and share the parsed input.
+                    if (solvePart1) {
+                        group.run([&solver, &result, &store, key, input]() {
+                            if (runStage(result.part1, [&]() { result.answer1 = solver.part1(*input); }) && store) {
+                                store->save(key, result.answer1);
+                            }
+                        });
+                    }
+                    if (solvePart2) {
+                        group.run([&solver, &result, &store, key2, input]() {
+                            if (runStage(result.part2, [&]() { result.answer2 = solver.part2(*input); }) && store) {
+                                store->save(key2, result.answer2);
+                            }
+                        });
+                    }
+                });
+            }
+            group.wait();
+        });
+
+        report.wallSeconds = wallTimer.elapsed();
+        return report;
+    }
+
+    void printReport(std::ostream &out, const Report &report) {
+        out << std::left << std::setw(7) << "day" << std::setw(20) << "part 1" << std::setw(20) << "part 2"
+            << std::right << std::setw(11) << "read [ms]" << std::setw(12) << "parse [ms]"
+            << std::setw(12) << "part1 [ms]" << std::setw(12) << "part2 [ms]" << "\n";
+
+        double slowestDay = 0.0;
+        double stagesTotal = 0.0;
+        for (const auto &result: report.days) {
+            out << std::left << std::setw(7) << solver::dayName(result.day)
+                << std::setw(20) << result.answer1 << std::setw(20) << result.answer2 << std::right
+                << std::setw(11) << formatStage(result.read) << std::setw(12) << formatStage(result.parse)
+                << std::setw(12) << formatStage(result.part1) << std::setw(12) << formatStage(result.part2) << "\n";
+
+            slowestDay = std::max(slowestDay, stageSeconds(result));
+            stagesTotal += stageSeconds(result);
+        }
+
+        for (const auto &result: report.days) {
+            for (const auto &[name, stage]: {std::pair{"read", &result.read}, std::pair{"parse", &result.parse},
+                                             std::pair{"part1", &result.part1}, std::pair{"part2", &result.part2}}) {
+                if (!stage->error.empty()) {
+                    out << solver::dayName(result.day) << " " << name << " failed: "
+                        << stage->error << "\n";
+                }
+            }
+        }
+
+        out << std::fixed << std::setprecision(3)
+            << "Wall time: " << report.wallSeconds * 1e3 << " ms (all stages: " << stagesTotal * 1e3
+            << " ms, slowest day: " << slowestDay * 1e3 << " ms)\n" << std::defaultfloat;
+    }
+
+}
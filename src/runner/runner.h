@@ -0,0 +1,72 @@
+
+#ifndef AOC_2023_RUNNER_H
+#define AOC_2023_RUNNER_H
+
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "cache.h"
+#include "solver.h"
+
+/**
+ * Runs many days in one process. Every day's input is read and parsed as a task of a shared
+ * TBB arena, and its parts are spawned as soon as the parse is done, so that inputs of later
+ * days are prefetched while earlier days are still solving.
+ */
+namespace runner {
+
+    struct Options {
+        // All registered days when empty.
+        std::vector<int> days{};
+        std::string inputDirectory{"."};
+        // Worker threads of the arena, 0 lets TBB decide.
+        int threads = 0;
+        // Runs part 2 of days marked slow (see solver::DayOptions).
+        bool includeSlow = false;
+        // Lets the solvers' diagnostics through to stdout.
+        bool verbose = false;
+        // Answers parts from the cache (see cache.h) and stores the answers of solved ones.
+        bool useCache = true;
+    };
+
+    /**
+     * Times are in seconds. A stage that was not run or failed has no time.
+     */
+    struct Stage {
+        double seconds{};
+        bool done = false;
+        // Done by looking the answer up, the time is that of the lookup.
+        bool cached = false;
+        std::string error{};
+    };
+
+    /**
+     * Completes a part's stage from the cache. Returns false on a miss.
+     */
+    bool findCached(const std::optional<cache::Store> &store, const cache::Key &key, Stage &stage,
+                    solver::Answer &answer);
+
+    struct DayResult {
+        int day{};
+        Stage read;
+        Stage parse;
+        Stage part1;
+        Stage part2;
+        solver::Answer answer1;
+        solver::Answer answer2;
+    };
+
+    struct Report {
+        std::vector<DayResult> days;
+        double wallSeconds{};
+    };
+
+    Report run(const Options &options);
+
+    void printReport(std::ostream &out, const Report &report);
+
+}
+
+#endif
@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "protocol.h"
+#include "solver.h"
+#include "timer.h"
+
+namespace {
+
+struct InputArgs {
+    int day;
+    std::string inputPath;
+    std::vector<int> parts{1, 2};
+    std::string socketPath{service::DEFAULT_SOCKET};
+    int repeat = 1;
+    bool areInvalid;
+};
+
+void printUsage() {
+    std::cout << "Usage: aoc_client <day> <input file> [--part=1|2] [--socket=PATH] [--repeat=N]\n";
+}
+
+InputArgs parseArguments(int argc, char *argv[]) {
+    InputArgs args{};
+    if (argc < 3) {
+        args.areInvalid = true;
+        return args;
+    }
+    try {
+        args.day = std::stoi(argv[1]);
+        args.inputPath = argv[2];
+        for (int i = 3; i < argc; i++) {
+            std::string_view arg{argv[i]};
+            auto value = [&arg]() {
+                return std::string(arg.substr(arg.find('=') + 1));
+            };
+
+            if (arg == "--part=1" || arg == "--part=2") {
+                args.parts = {std::stoi(value())};
+            } else if (arg.starts_with("--socket=")) {
+                args.socketPath = value();
+            } else if (arg.starts_with("--repeat=")) {
+                args.repeat = std::stoi(value());
+            } else {
+                args.areInvalid = true;
+            }
+        }
+    } catch (...) {
+        args.areInvalid = true;
+    }
+    if (args.repeat < 1) {
+        args.areInvalid = true;
+    }
+    return args;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+    InputArgs args{parseArguments(argc, argv)};
+    if (args.areInvalid) {
+        std::cout << "Input arguments are invalid." << std::endl;
+        printUsage();
+        return EXIT_FAILURE;
+    }
+
+    try {
+        auto connection = service::connect(args.socketPath);
+        service::Request request{.day = args.day, .input = solver::readInput(args.inputPath)};
+
+        int exitCode = EXIT_SUCCESS;
+        for (int part: args.parts) {
+            request.part = part;
+            service::Response response{};
+            std::vector<double> roundTrips{};
+            for (int i = 0; i < args.repeat; i++) {
+                Timer timer;
+                connection.write(request);
+                response = connection.readResponse();
+                roundTrips.push_back(timer.elapsed());
+            }
+            if (!response.ok) {
+                std::cerr << "[Part " << part << "] Error: " << response.value << std::endl;
+                exitCode = EXIT_FAILURE;
+                continue;
+            }
+            std::sort(roundTrips.begin(), roundTrips.end());
+            std::cout << response.value << "\n";
+            std::cout << "[Part " << part << "] Solved in " << response.seconds * 1e3 << " ms, round trip "
+                      << roundTrips[roundTrips.size() / 2] * 1e3 << " ms";
+            if (args.repeat > 1) {
+                std::cout << " (median of " << args.repeat << ", min " << roundTrips.front() * 1e3 << " ms)";
+            }
+            std::cout << std::endl;
+        }
+        return exitCode;
+    } catch (const std::exception &exception) {
+        std::cerr << exception.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,66 @@
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "server.h"
+
+namespace {
+
+struct InputArgs {
+    service::Options options;
+    bool areInvalid;
+};
+
+void printUsage() {
+    std::cout << "Usage: aoc_daemon [--socket=PATH] [--workers=N] [--verbose] [--no-cache]\n";
+}
+
+InputArgs parseArguments(int argc, char *argv[]) {
+    InputArgs args{};
+    try {
+        for (int i = 1; i < argc; i++) {
+            std::string_view arg{argv[i]};
+            auto value = [&arg]() {
+                return std::string(arg.substr(arg.find('=') + 1));
+            };
+
+            if (arg.starts_with("--socket=")) {
+                args.options.socketPath = value();
+            } else if (arg.starts_with("--workers=")) {
+                args.options.workers = std::stoi(value());
+            } else if (arg == "--verbose") {
+                args.options.verbose = true;
+            } else if (arg == "--no-cache") {
+                args.options.useCache = false;
+            } else {
+                args.areInvalid = true;
+            }
+        }
+    } catch (...) {
+        args.areInvalid = true;
+    }
+    if (args.options.workers < 0 || args.options.socketPath.empty()) {
+        args.areInvalid = true;
+    }
+    return args;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+    InputArgs args{parseArguments(argc, argv)};
+    if (args.areInvalid) {
+        std::cout << "Input arguments are invalid." << std::endl;
+        printUsage();
+        return EXIT_FAILURE;
+    }
+
+    try {
+        service::serve(args.options);
+    } catch (const std::exception &exception) {
+        std::cerr << exception.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
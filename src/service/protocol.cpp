@@ -0,0 +1,174 @@
+
+#include "protocol.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <system_error>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+
+    constexpr size_t READ_CHUNK = 64 * 1024;
+
+    std::system_error systemError(const std::string &what) {
+        return {errno, std::generic_category(), what};
+    }
+
+}
+
+namespace service {
+
+    Connection::Connection(Connection &&other) noexcept
+            : m_fd(other.m_fd), m_buffer(std::move(other.m_buffer)), m_position(other.m_position) {
+        other.m_fd = -1;
+    }
+
+    Connection::~Connection() {
+        if (m_fd != -1) {
+            close(m_fd);
+        }
+    }
+
+    bool Connection::fill() {
+        if (m_position > 0) {
+            m_buffer.erase(0, m_position);
+            m_position = 0;
+        }
+        auto size = m_buffer.size();
+        m_buffer.resize(size + READ_CHUNK);
+        ssize_t received;
+        do {
+            received = recv(m_fd, m_buffer.data() + size, READ_CHUNK, 0);
+        } while (received == -1 && errno == EINTR);
+        m_buffer.resize(size + static_cast<size_t>(std::max<ssize_t>(received, 0)));
+        if (received == -1) {
+            throw systemError("recv");
+        }
+        return received > 0;
+    }
+
+    bool Connection::readLine(std::string &line) {
+        size_t end;
+        while ((end = m_buffer.find('\n', m_position)) == std::string::npos) {
+            if (m_buffer.size() - m_position > 64) {
+                throw std::runtime_error("Malformed header");
+            }
+            if (!fill()) {
+                if (m_position == m_buffer.size()) {
+                    return false;
+                }
+                throw std::runtime_error("Connection closed inside a header");
+            }
+        }
+        line.assign(m_buffer, m_position, end - m_position);
+        m_position = end + 1;
+        return true;
+    }
+
+    void Connection::readExactly(std::string &out, size_t length) {
+        out.clear();
+        out.reserve(length);
+        while (out.size() < length) {
+            if (m_position == m_buffer.size() && !fill()) {
+                throw std::runtime_error("Connection closed inside a payload");
+            }
+            auto count = std::min(length - out.size(), m_buffer.size() - m_position);
+            out.append(m_buffer, m_position, count);
+            m_position += count;
+        }
+    }
+
+    void Connection::writeAll(const std::string &header, const std::string &payload) {
+        for (const auto *part: {&header, &payload}) {
+            size_t written = 0;
+            while (written < part->size()) {
+                auto sent = send(m_fd, part->data() + written, part->size() - written, MSG_NOSIGNAL);
+                if (sent == -1) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    throw systemError("send");
+                }
+                written += static_cast<size_t>(sent);
+            }
+        }
+    }
+
+    bool Connection::read(Request &request) {
+        std::string header{};
+        if (!readLine(header)) {
+            return false;
+        }
+        std::istringstream fields(header);
+        size_t length{};
+        if (!(fields >> request.day >> request.part >> length) || length > MAX_INPUT_SIZE) {
+            throw std::runtime_error("Malformed request header: " + header);
+        }
+        readExactly(request.input, length);
+        return true;
+    }
+
+    void Connection::write(const Request &request) {
+        writeAll(std::to_string(request.day) + " " + std::to_string(request.part) + " " +
+                 std::to_string(request.input.size()) + "\n", request.input);
+    }
+
+    Response Connection::readResponse() {
+        std::string header{};
+        if (!readLine(header)) {
+            throw std::runtime_error("Connection closed by the daemon");
+        }
+        std::istringstream fields(header);
+        std::string status{};
+        fields >> status;
+
+        Response response{};
+        response.ok = status == "ok";
+        long long nanoseconds = 0;
+        if (response.ok) {
+            fields >> nanoseconds;
+        } else if (status != "error") {
+            throw std::runtime_error("Malformed response header: " + header);
+        }
+        size_t length{};
+        if (!(fields >> length)) {
+            throw std::runtime_error("Malformed response header: " + header);
+        }
+        readExactly(response.value, length);
+        response.seconds = static_cast<double>(nanoseconds) * 1e-9;
+        return response;
+    }
+
+    void Connection::write(const Response &response) {
+        std::string header = response.ok
+                             ? "ok " + std::to_string(static_cast<long long>(response.seconds * 1e9)) + " "
+                             : "error ";
+        writeAll(header + std::to_string(response.value.size()) + "\n", response.value);
+    }
+
+    Connection connect(const std::string &socketPath) {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        if (socketPath.size() >= sizeof(address.sun_path)) {
+            throw std::invalid_argument("Socket path is too long: " + socketPath);
+        }
+        std::strcpy(address.sun_path, socketPath.c_str());
+
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd == -1) {
+            throw systemError("socket");
+        }
+        Connection connection(fd);
+        if (::connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) == -1) {
+            throw systemError("Cannot connect to " + socketPath);
+        }
+        return connection;
+    }
+
+}
@@ -0,0 +1,97 @@
+
+#ifndef AOC_2023_PROTOCOL_H
+#define AOC_2023_PROTOCOL_H
+
+#include <cstddef>
+#include <string>
+
+/**
+ * Wire format of aoc_daemon. A connection carries any number of requests, each answered before
+ * the next one is read:
+ *
+ *   request:  "<day> <part> <input length>\n" followed by the input bytes
+ *   response: "ok <solve nanoseconds> <answer length>\n" followed by the answer, or
+ *             "error <message length>\n" followed by the message
+ */
+namespace service {
+
+    constexpr const char *DEFAULT_SOCKET = "/tmp/aoc-2024.sock";
+
+    // Larger requests are rejected, the connection cannot be trusted afterwards.
+    constexpr size_t MAX_INPUT_SIZE = size_t{1} << 30;
+
+    struct Request {
+        int day{};
+        int part{};
+        std::string input;
+    };
+
+    struct Response {
+        bool ok{};
+        // The answer, or the error message.
+        std::string value;
+        double seconds{};
+    };
+
+    /**
+     * Buffered reads and writes on a connected socket, which it owns.
+     */
+    class Connection {
+    public:
+        explicit Connection(int fd) : m_fd(fd) {
+        }
+
+        Connection(const Connection &) = delete;
+
+        Connection &operator=(const Connection &) = delete;
+
+        Connection(Connection &&other) noexcept;
+
+        ~Connection();
+
+        [[nodiscard]] int fd() const {
+            return m_fd;
+        }
+
+        /**
+         * Whether bytes after the last request were read already, which polling the socket does not
+         * show.
+         */
+        [[nodiscard]] bool hasBuffered() const {
+            return m_position < m_buffer.size();
+        }
+
+        /**
+         * Reads the next request into the given one, reusing the capacity of its input.
+         * Returns false when the peer closed the connection between requests.
+         */
+        bool read(Request &request);
+
+        void write(const Request &request);
+
+        Response readResponse();
+
+        void write(const Response &response);
+
+    private:
+        int m_fd;
+        std::string m_buffer;
+        size_t m_position = 0;
+
+        bool fill();
+
+        bool readLine(std::string &line);
+
+        void readExactly(std::string &out, size_t length);
+
+        void writeAll(const std::string &header, const std::string &payload);
+    };
+
+    /**
+     * Throws std::system_error when nothing listens on the path.
+     */
+    Connection connect(const std::string &socketPath);
+
+}
+
+#endif
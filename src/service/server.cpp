@@ -0,0 +1,358 @@
+
+#include "server.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <poll.h>
+#include <pthread.h>
+#include <sys/eventfd.h>
+#include <sys/signalfd.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <tbb/concurrent_queue.h>
+
+#include "output_silencer.h"
+#include "solver.h"
+#include "timer.h"
+
+namespace {
+
+    // Seconds a worker waits for more of a request that the client stopped sending. Clients are
+    // local, so a pause this long means the client is stuck.
+    constexpr int REQUEST_TIMEOUT_SECONDS = 1;
+
+    /**
+     * Blocks SIGINT and SIGTERM in the calling thread and the threads it starts, and receives them
+     * through a descriptor instead, so that the accept loop sees them whichever thread they target.
+     */
+    class StopSignals {
+    public:
+        StopSignals() {
+            sigset_t signals{};
+            sigemptyset(&signals);
+            sigaddset(&signals, SIGINT);
+            sigaddset(&signals, SIGTERM);
+            pthread_sigmask(SIG_BLOCK, &signals, &m_previousMask);
+            m_fd = signalfd(-1, &signals, SFD_CLOEXEC);
+            if (m_fd == -1) {
+                int error = errno;
+                pthread_sigmask(SIG_SETMASK, &m_previousMask, nullptr);
+                throw std::system_error(error, std::generic_category(), "signalfd");
+            }
+        }
+
+        ~StopSignals() {
+            close(m_fd);
+            pthread_sigmask(SIG_SETMASK, &m_previousMask, nullptr);
+        }
+
+        StopSignals(const StopSignals &) = delete;
+
+        StopSignals &operator=(const StopSignals &) = delete;
+
+        [[nodiscard]] int fd() const {
+            return m_fd;
+        }
+
+        /**
+         * Takes the pending signal, which would otherwise be delivered once the mask is restored.
+         */
+        void consume() {
+            signalfd_siginfo info{};
+            [[maybe_unused]] auto bytes = read(m_fd, &info, sizeof(info));
+        }
+
+    private:
+        int m_fd = -1;
+        sigset_t m_previousMask{};
+    };
+
+    /**
+     * Connections the workers are serving. On stop, their reading side is shut down, so that workers
+     * waiting for the rest of a request see the end of the connection, while a request being solved
+     * is still answered.
+     */
+    class OpenConnections {
+    public:
+        void add(int fd) {
+            std::lock_guard lock(m_mutex);
+            m_fds.push_back(fd);
+            if (m_stopping) {
+                shutdown(fd, SHUT_RD);
+            }
+        }
+
+        void remove(int fd) {
+            std::lock_guard lock(m_mutex);
+            m_fds.erase(std::find(m_fds.begin(), m_fds.end(), fd));
+        }
+
+        void stop() {
+            std::lock_guard lock(m_mutex);
+            m_stopping = true;
+            for (int fd: m_fds) {
+                shutdown(fd, SHUT_RD);
+            }
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::vector<int> m_fds{};
+        bool m_stopping = false;
+    };
+
+    /**
+     * Whether a daemon accepts connections on the path.
+     */
+    bool isServed(const sockaddr_un &address) {
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd == -1) {
+            throw std::system_error(errno, std::generic_category(), "socket");
+        }
+        bool connected = connect(fd, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) == 0;
+        close(fd);
+        return connected;
+    }
+
+    int listenOn(const std::string &socketPath) {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        if (socketPath.size() >= sizeof(address.sun_path)) {
+            throw std::invalid_argument("Socket path is too long: " + socketPath);
+        }
+        std::strcpy(address.sun_path, socketPath.c_str());
+
+        if (isServed(address)) {
+            throw std::runtime_error("Another daemon is serving on " + socketPath);
+        }
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd == -1) {
+            throw std::system_error(errno, std::generic_category(), "socket");
+        }
+        // A socket left behind by a daemon that was killed would make bind fail.
+        unlink(socketPath.c_str());
+        if (bind(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) == -1 || listen(fd, SOMAXCONN) == -1) {
+            int error = errno;
+            close(fd);
+            throw std::system_error(error, std::generic_category(), "Cannot listen on " + socketPath);
+        }
+        return fd;
+    }
+
+    using ConnectionPtr = std::unique_ptr<service::Connection>;
+
+    /**
+     * Connections that workers hand back after a request, for the accept loop to wait for their
+     * next one. A descriptor wakes the loop when there are any.
+     */
+    class ReturnedConnections {
+    public:
+        ReturnedConnections() : m_fd(eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)) {
+            if (m_fd == -1) {
+                throw std::system_error(errno, std::generic_category(), "eventfd");
+            }
+        }
+
+        ~ReturnedConnections() {
+            close(m_fd);
+        }
+
+        ReturnedConnections(const ReturnedConnections &) = delete;
+
+        ReturnedConnections &operator=(const ReturnedConnections &) = delete;
+
+        [[nodiscard]] int fd() const {
+            return m_fd;
+        }
+
+        void push(ConnectionPtr connection) {
+            std::lock_guard lock(m_mutex);
+            m_connections.push_back(std::move(connection));
+            uint64_t one = 1;
+            [[maybe_unused]] auto bytes = write(m_fd, &one, sizeof(one));
+        }
+
+        void moveTo(std::vector<ConnectionPtr> &idle) {
+            uint64_t count{};
+            [[maybe_unused]] auto bytes = read(m_fd, &count, sizeof(count));
+            std::lock_guard lock(m_mutex);
+            std::move(m_connections.begin(), m_connections.end(), std::back_inserter(idle));
+            m_connections.clear();
+        }
+
+    private:
+        int m_fd;
+        std::mutex m_mutex;
+        std::vector<ConnectionPtr> m_connections{};
+    };
+
+    /**
+     * Serves the requests of connections with one to read, and hands the connections back between
+     * requests, so that idle clients hold no worker. The request is kept between connections, so the
+     * input buffer of a worker grows to the largest input it has seen and is not allocated again.
+     */
+    void work(tbb::concurrent_bounded_queue<ConnectionPtr> &ready, ReturnedConnections &returned,
+              OpenConnections &open, const std::optional<cache::Store> &store) {
+        service::Request request{};
+        while (true) {
+            ConnectionPtr connection{};
+            ready.pop(connection);
+            if (!connection) {
+                return;
+            }
+            open.add(connection->fd());
+            bool served = false;
+            try {
+                // Requests the client sent at once are buffered already, and polling would miss them.
+                do {
+                    served = connection->read(request);
+                    if (served) {
+                        connection->write(service::solve(request, store));
+                    }
+                } while (served && connection->hasBuffered());
+            } catch (const std::exception &exception) {
+                // Broken connection, protocol error or stalled request, the connection is dropped.
+                std::cerr << "Connection dropped: " << exception.what() << std::endl;
+                served = false;
+            }
+            // Removed before the connection closes the descriptor, which may then be reused.
+            open.remove(connection->fd());
+            if (served) {
+                returned.push(std::move(connection));
+            }
+        }
+    }
+
+}
+
+namespace service {
+
+    Response solve(const Request &request, const std::optional<cache::Store> &store) {
+        try {
+            const auto &solver = solver::find(request.day);
+            if (request.part != 1 && request.part != 2) {
+                throw std::invalid_argument("Part must be 1 or 2");
+            }
+            Timer timer;
+            auto key = cache::makeKey(solver, request.part, request.input);
+            if (auto cached = store ? store->find(key) : std::nullopt) {
+                return {.ok = true, .value = cached->value, .seconds = timer.elapsed()};
+            }
+
+            auto input = solver.parse(request.input);
+            auto answer = request.part == 1 ? solver.part1(input) : solver.part2(input);
+            auto elapsed = timer.elapsed();
+            if (store) {
+                store->save(key, answer);
+            }
+            return {.ok = true, .value = answer.value, .seconds = elapsed};
+        } catch (const std::exception &exception) {
+            return {.ok = false, .value = exception.what(), .seconds = 0.0};
+        }
+    }
+
+    void serve(const Options &options) {
+        int workerCount = options.workers > 0
+                          ? options.workers
+                          : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+        int listener = listenOn(options.socketPath);
+        // Before the workers start, so that they inherit the blocked signals.
+        StopSignals stopSignals{};
+        std::cerr << "Serving " << solver::days().size() << " days on " << options.socketPath << " with "
+                  << workerCount << " workers" << std::endl;
+
+        std::optional<OutputSilencer> silencer{};
+        if (!options.verbose) {
+            silencer.emplace();
+        }
+
+        auto store = options.useCache ? cache::Store::open() : std::nullopt;
+        tbb::concurrent_bounded_queue<ConnectionPtr> ready{};
+        ReturnedConnections returned{};
+        OpenConnections open{};
+        std::vector<std::thread> workers{};
+        for (int i = 0; i < workerCount; i++) {
+            workers.emplace_back(work, std::ref(ready), std::ref(returned), std::ref(open), std::cref(store));
+        }
+
+        // Connections waiting for their next request, only this thread touches them.
+        std::vector<ConnectionPtr> idle{};
+        std::vector<pollfd> events{};
+        while (true) {
+            events.clear();
+            for (int fd: {listener, stopSignals.fd(), returned.fd()}) {
+                events.push_back({.fd = fd, .events = POLLIN, .revents = 0});
+            }
+            for (const auto &connection: idle) {
+                events.push_back({.fd = connection->fd(), .events = POLLIN, .revents = 0});
+            }
+            if (poll(events.data(), events.size(), -1) == -1) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                std::cerr << "poll: " << std::strerror(errno) << std::endl;
+                break;
+            }
+            if (events[1].revents != 0) {
+                stopSignals.consume();
+                break;
+            }
+
+            // A hang-up is handed to a worker too, which then drops the connection.
+            auto event = events.begin() + 3;
+            std::erase_if(idle, [&](ConnectionPtr &connection) {
+                if ((event++)->revents == 0) {
+                    return false;
+                }
+                ready.push(std::move(connection));
+                return true;
+            });
+            if (events[2].revents != 0) {
+                returned.moveTo(idle);
+            }
+            if (events[0].revents != 0) {
+                int fd = accept(listener, nullptr, nullptr);
+                if (fd == -1) {
+                    if (errno == EINTR || errno == ECONNABORTED) {
+                        continue;
+                    }
+                    std::cerr << "accept: " << std::strerror(errno) << std::endl;
+                    break;
+                }
+                // A client that stops in the middle of a request gives its worker up after a while.
+                timeval timeout{.tv_sec = REQUEST_TIMEOUT_SECONDS, .tv_usec = 0};
+                setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+                idle.push_back(std::make_unique<service::Connection>(fd));
+            }
+        }
+        open.stop();
+
+        // Requests being solved are answered, idle and waiting connections end.
+        for (int i = 0; i < workerCount; i++) {
+            ready.push(nullptr);
+        }
+        for (auto &worker: workers) {
+            worker.join();
+        }
+        close(listener);
+        unlink(options.socketPath.c_str());
+    }
+
+}
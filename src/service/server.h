@@ -0,0 +1,38 @@
+
+#ifndef AOC_2023_SERVER_H
+#define AOC_2023_SERVER_H
+
+#include <optional>
+#include <string>
+
+#include "cache.h"
+#include "protocol.h"
+
+/**
+ * Solver daemon: all registered solvers stay loaded and answer requests on a Unix domain socket,
+ * so that interactive queries pay neither process start-up nor cold caches and allocators.
+ */
+namespace service {
+
+    struct Options {
+        std::string socketPath{DEFAULT_SOCKET};
+        // Requests served at the same time, 0 means one per hardware thread. Connections wait for
+        // their next request outside of the workers.
+        int workers = 0;
+        // Lets the solvers' diagnostics through to stdout.
+        bool verbose = false;
+        // Answers from the cache (see cache.h) and stores the answers of solved requests.
+        bool useCache = true;
+    };
+
+    Response solve(const Request &request, const std::optional<cache::Store> &store);
+
+    /**
+     * Serves until SIGINT or SIGTERM, then removes the socket. Throws std::runtime_error when another
+     * daemon serves on the socket already.
+     */
+    void serve(const Options &options);
+
+}
+
+#endif
@@ -0,0 +1,69 @@
+#include "allocations.h"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <new>
+
+// Built into a test binary of its own with AOC_TRACK_ALLOCATIONS, see tests/CMakeLists.txt. The
+// allocation functions are called directly, as new-expressions may be elided.
+
+TEST(Allocations, TrackingIsOn) {
+    EXPECT_TRUE(allocations::isTrackingEnabled());
+}
+
+TEST(Allocations, CountsAllocationsBytesAndPeak) {
+    auto before = allocations::snapshot();
+    allocations::Phase phase{};
+    void *first = ::operator new(100);
+    void *second = ::operator new[](300);
+    ::operator delete(first);
+    void *third = ::operator new(50);
+    auto stats = phase.stats();
+    ::operator delete[](second);
+    ::operator delete(third, 50);
+
+    EXPECT_EQ(stats.allocations, 3u);
+    EXPECT_EQ(stats.deallocations, 1u);
+    EXPECT_EQ(stats.bytes, 450u);
+    EXPECT_EQ(stats.liveBytes, before.liveBytes + 350);
+    EXPECT_EQ(stats.peakLiveBytes, 400u);
+    EXPECT_EQ(allocations::snapshot().liveBytes, before.liveBytes);
+}
+
+TEST(Allocations, CountsAlignedAllocations) {
+    auto before = allocations::snapshot();
+    allocations::Phase phase{};
+    // Above the default alignment, and with a size that is not a multiple of the alignment.
+    void *page = ::operator new(10, std::align_val_t{4096});
+    void *line = ::operator new[](64, std::align_val_t{64});
+    void *nothrow = ::operator new(24, std::align_val_t{128}, std::nothrow);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(page) % 4096, 0u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(line) % 64, 0u);
+    ASSERT_NE(nothrow, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(nothrow) % 128, 0u);
+    ::operator delete(page, std::align_val_t{4096});
+    ::operator delete[](line, 64, std::align_val_t{64});
+    ::operator delete(nothrow, std::align_val_t{128}, std::nothrow);
+    auto stats = phase.stats();
+
+    EXPECT_EQ(stats.allocations, 3u);
+    EXPECT_EQ(stats.deallocations, 3u);
+    EXPECT_EQ(stats.bytes, 98u);
+    EXPECT_EQ(stats.peakLiveBytes, 98u);
+    EXPECT_EQ(allocations::snapshot().liveBytes, before.liveBytes);
+}
+
+TEST(Allocations, ResetStartsAPhaseFromTheLiveBytes) {
+    allocations::Phase phase{};
+    void *kept = ::operator new(1000);
+    phase.reset();
+    void *small = ::operator new(10);
+    ::operator delete(small);
+    auto stats = phase.stats();
+    ::operator delete(kept);
+
+    EXPECT_EQ(stats.allocations, 1u);
+    EXPECT_EQ(stats.deallocations, 1u);
+    EXPECT_EQ(stats.bytes, 10u);
+    // The block from before the reset does not count towards the peak.
+    EXPECT_EQ(stats.peakLiveBytes, 10u);
+}
@@ -0,0 +1,57 @@
+#include "arena.h"
+#include "input.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+TEST(Arena, CurrentIsTheDefaultOutsideOfScopes) {
+    EXPECT_EQ(arena::current(), std::pmr::get_default_resource());
+}
+
+TEST(Arena, ScopesNestAndRestore) {
+    arena::Scope outer{};
+    EXPECT_EQ(arena::current(), outer.resource());
+    {
+        arena::Scope inner{};
+        EXPECT_EQ(arena::current(), inner.resource());
+    }
+    EXPECT_EQ(arena::current(), outer.resource());
+}
+
+TEST(Arena, SuspendFallsBackToTheDefault) {
+    arena::Scope scope{};
+    {
+        arena::Suspend suspend{};
+        EXPECT_EQ(arena::current(), std::pmr::get_default_resource());
+    }
+    EXPECT_EQ(arena::current(), scope.resource());
+}
+
+TEST(Arena, ScopeOutgrowsItsFirstBlock) {
+    arena::Scope scope{};
+    std::pmr::vector<std::pmr::string> strings{arena::current()};
+    for (int i = 0; i < 100000; i++) {
+        strings.emplace_back("a string too long for the small string optimization");
+    }
+    EXPECT_EQ(strings.size(), 100000u);
+    EXPECT_EQ(strings.back().get_allocator().resource(), scope.resource());
+}
+
+TEST(Arena, SplitMatchesTheStandardContainers) {
+    arena::Scope scope{};
+    for (std::string text: {"a,b,,c", ",a,", "", "abc", "a,b,"}) {
+        auto expected = input::split(text, ',', input::Blanks::Allow);
+        auto parts = input::split(text, ',', input::Blanks::Allow, arena::current());
+        ASSERT_EQ(parts.size(), expected.size()) << text;
+        for (size_t i = 0; i < parts.size(); i++) {
+            EXPECT_EQ(std::string(parts[i]), expected[i]) << text;
+        }
+    }
+}
+
+TEST(Arena, ParseVectorParsesNumbersInPlace) {
+    arena::Scope scope{};
+    auto numbers = input::parseVector<int>(" 1 -20  300 ", ' ', arena::current());
+    EXPECT_EQ(std::vector<int>(numbers.begin(), numbers.end()), (std::vector<int>{1, -20, 300}));
+    EXPECT_THROW(input::parseVector<int>("1 x", ' ', arena::current()), std::invalid_argument);
+}
@@ -0,0 +1,67 @@
+#include "checked.h"
+#include "solver.h"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <limits>
+
+TEST(Checked, ThrowsInsteadOfWrapping) {
+    EXPECT_EQ(checked::add<int64_t>(INT64_MAX - 1, 1), INT64_MAX);
+    EXPECT_THROW(checked::add<int64_t>(INT64_MAX, 1), std::overflow_error);
+    EXPECT_EQ(checked::mul(46340, 46340), 2147395600);
+    EXPECT_THROW(checked::mul(46341, 46341), std::overflow_error);
+    EXPECT_THROW(checked::mul<checked::Wide>(checked::Wide{1} << 64, checked::Wide{1} << 64), std::overflow_error);
+}
+
+TEST(Checked, NarrowsOnlyWhatFits) {
+    EXPECT_EQ(checked::narrow<int32_t>(checked::Wide{-5}), -5);
+    EXPECT_EQ(checked::narrow<uint64_t>(checked::Wide{UINT64_MAX}), UINT64_MAX);
+    EXPECT_THROW(checked::narrow<uint64_t>(checked::Wide{-1}), std::overflow_error);
+    EXPECT_THROW(checked::narrow<int64_t>(checked::Wide{INT64_MAX} + 1), std::overflow_error);
+}
+
+TEST(Checked, PrintsWideValues) {
+    EXPECT_EQ(checked::toString(0), "0");
+    EXPECT_EQ(checked::toString(-42), "-42");
+    EXPECT_EQ(checked::toString(checked::Wide{1} << 64), "18446744073709551616");
+    EXPECT_EQ(checked::toString(std::numeric_limits<checked::Wide>::min()),
+              "-170141183460469231731687303715884105728");
+    EXPECT_EQ(solver::Answer(checked::Wide{INT64_MAX} * 10).value, "92233720368547758070");
+}
+
+TEST(Checked, AccumulatesWithoutOverflow) {
+    checked::Accumulator sum{};
+    sum.add(5);
+    sum.add(-3);
+    EXPECT_FALSE(sum.widened());
+    EXPECT_TRUE(sum.total() == 2);
+
+    for (int i = 0; i < 10; i++) {
+        sum.add(INT64_MAX);
+    }
+    EXPECT_TRUE(sum.widened());
+    EXPECT_TRUE(sum.total() == 10 * checked::Wide{INT64_MAX} + 2);
+
+    for (int i = 0; i < 10; i++) {
+        sum.add(INT64_MIN);
+    }
+    EXPECT_TRUE(sum.total() == 10 * (checked::Wide{INT64_MAX} + INT64_MIN) + 2);
+}
+
+TEST(Checked, AccumulatesProductsBeyondSixtyFourBits) {
+    checked::Accumulator sum{};
+    sum.addProduct(1000, 1000);
+    sum.addProduct(INT64_MAX, 4);
+    sum.addProduct(INT64_MIN, -1);
+    EXPECT_TRUE(sum.total() == 1000000 + 4 * checked::Wide{INT64_MAX} - checked::Wide{INT64_MIN});
+}
+
+TEST(Checked, MergesPartialSums) {
+    checked::Accumulator left{};
+    checked::Accumulator right{};
+    for (int i = 0; i < 3; i++) {
+        left.add(INT64_MAX);
+        right.add(INT64_MAX);
+    }
+    auto total = left + right;
+    EXPECT_TRUE(total.total() == 6 * checked::Wide{INT64_MAX});
+}
@@ -0,0 +1,117 @@
+#include "differential.h"
+#include "generator.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+
+    constexpr uint64_t SEEDS = 8;
+
+    /**
+     * Small inputs find most bugs and shrink quickly, the largest one is an eighth of the puzzle's.
+     */
+    std::vector<uint64_t> sizesFor(const generator::Generator &generator) {
+        std::vector<uint64_t> sizes{1, 2, 5, 20, std::max<uint64_t>(generator.defaultSize / 8, 1)};
+        for (auto &size: sizes) {
+            size = std::min(size, generator.maxSize);
+        }
+        return sizes;
+    }
+
+    size_t countSevens(std::string_view text) {
+        return std::count(text.begin(), text.end(), '7');
+    }
+
+    // Counts a run of sevens as one seven.
+    size_t countSevensWrongly(std::string_view text) {
+        size_t count = 0;
+        for (size_t i = 0; i < text.size(); i++) {
+            if (text[i] == '7' && (i == 0 || text[i - 1] != '7')) {
+                count++;
+            }
+        }
+        return count;
+    }
+
+    const differential::Check SEVENS{
+            .day = 0,
+            .part = 1,
+            .name = "countSevens",
+            .reference = [](std::string_view text) { return solver::Answer(countSevens(text)); },
+            .optimized = [](std::string_view text) { return solver::Answer(countSevensWrongly(text)); },
+    };
+
+}
+
+TEST(Differential, ComparesAnswers) {
+    EXPECT_FALSE(differential::compare(SEVENS, "1727\n").has_value());
+    auto mismatch = differential::compare(SEVENS, "177\n");
+    ASSERT_TRUE(mismatch.has_value());
+    EXPECT_EQ(mismatch->reference, solver::Answer(2));
+    EXPECT_EQ(mismatch->optimized, solver::Answer(1));
+}
+
+TEST(Differential, ShrinksToMinimalReproducer) {
+    EXPECT_EQ(differential::shrink(SEVENS, "123\n4577x\n7\n89\n"), "77");
+}
+
+TEST(Differential, SkipsCandidatesThatThrow) {
+    // Inputs without a semicolon are rejected, so the shrunk input keeps one.
+    differential::Check check = SEVENS;
+    check.reference = [](std::string_view text) {
+        if (text.find(';') == std::string_view::npos) {
+            throw std::invalid_argument("No semicolon");
+        }
+        return solver::Answer(countSevens(text));
+    };
+    auto shrunk = differential::shrink(check, "1;\n277\n3\n");
+    EXPECT_EQ(shrunk.size(), 3u);
+    EXPECT_NE(shrunk.find(';'), std::string::npos);
+    EXPECT_NE(shrunk.find("77"), std::string::npos);
+}
+
+TEST(Differential, ShrinksGeneratedInputOfARealDay) {
+    // Day 5's reference with an optimized part that answers wrongly whenever an update needs reordering.
+    auto checks = differential::checks();
+    auto day05 = std::find_if(checks.begin(), checks.end(), [](const differential::Check &check) {
+        return check.day == 5 && check.part == 2;
+    });
+    ASSERT_NE(day05, checks.end());
+    differential::Check check = *day05;
+    check.optimized = [reference = day05->reference](std::string_view text) {
+        auto answer = reference(text);
+        return answer == solver::Answer(0) ? answer : solver::Answer("wrong");
+    };
+
+    auto input = generator::generate(5, 5, 1);
+    ASSERT_TRUE(differential::compare(check, input).has_value());
+    auto reproducer = differential::shrink(check, input);
+    EXPECT_TRUE(differential::compare(check, reproducer).has_value());
+    // A rule and an update of its two pages in the wrong order.
+    EXPECT_LE(reproducer.size(), 14u) << reproducer;
+}
+
+TEST(Differential, OptimizedSolversMatchReferences) {
+    auto checks = differential::checks();
+    ASSERT_FALSE(checks.empty());
+    for (const auto &check: checks) {
+        SCOPED_TRACE("day " + std::to_string(check.day) + " part " + std::to_string(check.part) + " " + check.name);
+        const auto &generator = generator::find(check.day);
+        for (auto size: sizesFor(generator)) {
+            for (uint64_t seed = 1; seed <= SEEDS; seed++) {
+                auto input = generator::generate(check.day, size, seed);
+                auto mismatch = differential::compare(check, input);
+                if (mismatch) {
+                    auto reproducer = differential::shrink(check, input);
+                    auto shrunk = differential::compare(check, reproducer).value_or(*mismatch);
+                    ADD_FAILURE() << "size " << size << " seed " << seed << ": reference " << shrunk.reference
+                                  << ", optimized " << shrunk.optimized << " on\n" << reproducer;
+                    break;
+                }
+            }
+        }
+    }
+}
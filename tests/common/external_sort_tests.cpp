@@ -0,0 +1,100 @@
+#include "external_sort.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+
+namespace {
+
+    std::vector<int32_t> randomValues(size_t count, uint32_t seed) {
+        std::mt19937 random(seed);
+        std::uniform_int_distribution<int32_t> distribution(-1000, 1000);
+        std::vector<int32_t> values(count);
+        for (auto &value: values) {
+            value = distribution(random);
+        }
+        return values;
+    }
+
+    std::vector<int32_t> drain(external_sort::Merger<int32_t> merger) {
+        std::vector<int32_t> values{};
+        int32_t value;
+        while (merger.next(value)) {
+            values.push_back(value);
+        }
+        return values;
+    }
+
+    /**
+     * Sorts the values within the budget and checks the result against std::sort.
+     */
+    size_t checkSorted(const std::vector<int32_t> &values, size_t budgetBytes) {
+        external_sort::Sorter<int32_t> sorter(budgetBytes);
+        for (auto value: values) {
+            sorter.push(value);
+        }
+        sorter.finish();
+        auto expected = values;
+        std::sort(expected.begin(), expected.end());
+        EXPECT_EQ(sorter.size(), values.size());
+        EXPECT_EQ(drain(sorter.sorted()), expected);
+        return sorter.runCount();
+    }
+
+}
+
+TEST(ExternalSort, SortsInMemoryWithinTheBudget) {
+    EXPECT_EQ(checkSorted(randomValues(1000, 1), 4000), 0u);
+    EXPECT_EQ(checkSorted({}, 64), 0u);
+}
+
+TEST(ExternalSort, MergesRunsFromDisk) {
+    // Runs of 128K values, few enough to merge in one pass.
+    EXPECT_EQ(checkSorted(randomValues(300000, 2), 512 * 1024), 3u);
+}
+
+TEST(ExternalSort, MergesInSeveralPassesWhenRunsExceedTheFanIn) {
+    // Runs of 16 values, of which a pass merges two.
+    EXPECT_EQ(checkSorted(randomValues(1001, 3), 64), 2u);
+    EXPECT_EQ(checkSorted(randomValues(10000, 3), 4096), 2u);
+}
+
+TEST(ExternalSort, KeepsFewRunsOpenWhileValuesComeIn) {
+    // Runs of 16 values merged two at a time, 6250 runs in all.
+    external_sort::Sorter<int32_t> sorter(64);
+    auto values = randomValues(100000, 5);
+    size_t mostRuns = 0;
+    for (auto value: values) {
+        sorter.push(value);
+        mostRuns = std::max(mostRuns, sorter.runCount());
+    }
+    EXPECT_LE(mostRuns, 14u);
+    sorter.finish();
+    std::sort(values.begin(), values.end());
+    EXPECT_EQ(drain(sorter.sorted()), values);
+}
+
+TEST(ExternalSort, ReadsTheSortedValuesRepeatedly) {
+    external_sort::Sorter<int32_t> sorter(256);
+    auto values = randomValues(500, 4);
+    for (auto value: values) {
+        sorter.push(value);
+    }
+    sorter.finish();
+    auto first = drain(sorter.sorted());
+    EXPECT_EQ(drain(sorter.sorted()), first);
+    EXPECT_TRUE(std::is_sorted(first.begin(), first.end()));
+}
+
+TEST(ExternalSort, RejectsBudgetsBelowTwoValues) {
+    EXPECT_THROW(external_sort::Sorter<int64_t>(15), std::invalid_argument);
+}
+
+TEST(ExternalSort, ParsesSizes) {
+    EXPECT_EQ(external_sort::parseSize("4096"), 4096u);
+    EXPECT_EQ(external_sort::parseSize("64K"), 64u * 1024);
+    EXPECT_EQ(external_sort::parseSize("512M"), 512u * 1024 * 1024);
+    EXPECT_EQ(external_sort::parseSize("2G"), 2ull * 1024 * 1024 * 1024);
+    EXPECT_THROW(external_sort::parseSize("0"), std::invalid_argument);
+    EXPECT_THROW(external_sort::parseSize("12Q"), std::invalid_argument);
+    EXPECT_THROW(external_sort::parseSize("M"), std::invalid_argument);
+}
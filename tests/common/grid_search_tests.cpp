@@ -0,0 +1,203 @@
+#include "grid_search.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    using grid_search::Distance;
+    using grid_search::State;
+
+    struct Edge {
+        State to;
+        Distance weight;
+    };
+
+    using Graph = std::vector<std::vector<Edge>>;
+
+    Graph randomGraph(std::mt19937 &random, std::size_t states, std::size_t edges, Distance maxWeight) {
+        Graph graph(states);
+        for (std::size_t edge = 0; edge < edges; edge++) {
+            graph[random() % states].push_back({static_cast<State>(random() % states),
+                                                static_cast<Distance>(random() % (maxWeight + 1))});
+        }
+        return graph;
+    }
+
+    Graph reversed(const Graph &graph) {
+        Graph reverse(graph.size());
+        for (State from = 0; from < graph.size(); from++) {
+            for (auto edge: graph[from]) {
+                reverse[edge.to].push_back({from, edge.weight});
+            }
+        }
+        return reverse;
+    }
+
+    auto neighborsOf(const Graph &graph) {
+        return [&graph](State state, auto &&emit) {
+            for (auto edge: graph[state]) {
+                emit(edge.to, edge.weight);
+            }
+        };
+    }
+
+    std::vector<Distance> referenceDistances(const Graph &graph, State source) {
+        std::vector<Distance> distances(graph.size(), grid_search::UNREACHED);
+        using Entry = std::pair<Distance, State>;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<>> queue;
+        distances[source] = 0;
+        queue.emplace(0, source);
+        while (!queue.empty()) {
+            auto [distance, state] = queue.top();
+            queue.pop();
+            if (distance > distances[state]) {
+                continue;
+            }
+            for (auto edge: graph[state]) {
+                if (distance + edge.weight < distances[edge.to]) {
+                    distances[edge.to] = distance + edge.weight;
+                    queue.emplace(distances[edge.to], edge.to);
+                }
+            }
+        }
+        return distances;
+    }
+
+    // '#' are walls, the rest are open tiles.
+    const std::vector<std::string> MAZE{
+            "....#",
+            ".##.#",
+            ".#...",
+            "...#.",
+    };
+
+    auto mazeNeighbors(const grid_search::GridStates &tiles) {
+        return [&tiles](State state, auto &&emit) {
+            for (auto direction: getAllDirections()) {
+                auto next = tiles.coord(state) + direction;
+                if (tiles.contains(next) && MAZE[next.row][next.col] != '#') {
+                    emit(tiles.encode(next));
+                }
+            }
+        };
+    }
+
+}
+
+TEST(GridSearch, EncodesCoordsAndLayers) {
+    grid_search::GridStates states(3, 5, 4);
+    EXPECT_EQ(states.count(), 60u);
+    auto state = states.encode(Coord{.col = 3, .row = 2}, 1);
+    EXPECT_EQ(states.coord(state), (Coord{.col = 3, .row = 2}));
+    EXPECT_EQ(states.layer(state), 1u);
+    EXPECT_FALSE(states.contains(Coord{.col = 5, .row = 0}));
+    EXPECT_FALSE(states.contains(Coord{.col = 0, .row = -1}));
+}
+
+TEST(GridSearch, BfsFindsShortestPathsOnGrid) {
+    grid_search::GridStates tiles(MAZE.size(), MAZE[0].size());
+    grid_search::Bfs search(tiles.count());
+    search.run({tiles.encode(Coord{.col = 0, .row = 0})}, mazeNeighbors(tiles));
+
+    auto corner = tiles.encode(Coord{.col = 4, .row = 3});
+    EXPECT_EQ(search.distance(corner), 7u);
+    auto path = search.path(corner);
+    ASSERT_EQ(path.size(), 8u);
+    EXPECT_EQ(path.front(), tiles.encode(Coord{.col = 0, .row = 0}));
+    EXPECT_EQ(path.back(), corner);
+    EXPECT_FALSE(search.reached(tiles.encode(Coord{.col = 4, .row = 0})));
+    EXPECT_TRUE(search.path(tiles.encode(Coord{.col = 4, .row = 0})).empty());
+
+    // Reached states come out by distance.
+    Distance previous = 0;
+    for (auto state: search.reachedStates()) {
+        EXPECT_GE(search.distance(state), previous);
+        previous = search.distance(state);
+    }
+}
+
+TEST(GridSearch, BfsStopsAtTargetAndResetsBetweenRuns) {
+    grid_search::GridStates tiles(MAZE.size(), MAZE[0].size());
+    grid_search::Bfs search(tiles.count());
+    auto target = tiles.encode(Coord{.col = 3, .row = 0});
+    std::vector<State> sources{tiles.encode(Coord{.col = 0, .row = 3})};
+    auto found = search.run(sources, mazeNeighbors(tiles), [target](State state) { return state == target; });
+    EXPECT_EQ(found, target);
+    EXPECT_EQ(search.distance(target), 6u);
+
+    search.run({target}, mazeNeighbors(tiles));
+    EXPECT_EQ(search.distance(target), 0u);
+    EXPECT_EQ(search.predecessor(target), grid_search::NO_STATE);
+    EXPECT_EQ(search.distance(tiles.encode(Coord{.col = 0, .row = 3})), 6u);
+}
+
+TEST(GridSearch, DijkstraMatchesReference) {
+    std::mt19937 random(11);
+    for (Distance maxWeight: {1u, 3u, 20u}) {
+        auto graph = randomGraph(random, 200, 700, maxWeight);
+        grid_search::Dijkstra search(graph.size(), maxWeight);
+        for (State source: {0u, 17u, 199u}) {
+            search.run({source}, neighborsOf(graph));
+            auto expected = referenceDistances(graph, source);
+            for (State state = 0; state < graph.size(); state++) {
+                ASSERT_EQ(search.distance(state), expected[state]) << "state " << state;
+            }
+        }
+    }
+}
+
+TEST(GridSearch, DijkstraPathsSumToDistances) {
+    std::mt19937 random(5);
+    auto graph = randomGraph(random, 100, 400, 9);
+    grid_search::Dijkstra search(graph.size(), 9);
+    search.run({0u}, neighborsOf(graph));
+    for (auto state: search.reachedStates()) {
+        auto path = search.path(state);
+        Distance length = 0;
+        for (std::size_t step = 1; step < path.size(); step++) {
+            Distance cheapest = grid_search::UNREACHED;
+            for (auto edge: graph[path[step - 1]]) {
+                if (edge.to == path[step]) {
+                    cheapest = std::min(cheapest, edge.weight);
+                }
+            }
+            length += cheapest;
+        }
+        EXPECT_EQ(length, search.distance(state));
+    }
+}
+
+TEST(GridSearch, BidirectionalMatchesDijkstra) {
+    std::mt19937 random(3);
+    for (Distance maxWeight: {1u, 7u}) {
+        auto graph = randomGraph(random, 150, 350, maxWeight);
+        auto reverse = reversed(graph);
+        grid_search::Dijkstra forward(graph.size(), maxWeight);
+        grid_search::Dijkstra backward(graph.size(), maxWeight);
+        for (int trial = 0; trial < 50; trial++) {
+            State source = random() % graph.size();
+            State target = random() % graph.size();
+            auto expected = referenceDistances(graph, source)[target];
+            State meeting = grid_search::NO_STATE;
+            auto distance = grid_search::bidirectional(
+                    forward, backward, std::span<const State>(&source, 1), std::span<const State>(&target, 1),
+                    neighborsOf(graph), neighborsOf(reverse), &meeting);
+            ASSERT_EQ(distance, expected) << source << " -> " << target;
+            if (distance != grid_search::UNREACHED) {
+                EXPECT_EQ(forward.distance(meeting) + backward.distance(meeting), distance);
+            }
+        }
+    }
+}
+
+TEST(GridSearch, RejectsHeavyEdges) {
+    Graph graph{{{1, 5}}, {}};
+    grid_search::Dijkstra search(graph.size(), 4);
+    EXPECT_THROW(search.run({0u}, neighborsOf(graph)), std::out_of_range);
+}
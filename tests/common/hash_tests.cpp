@@ -0,0 +1,25 @@
+#include "hash.h"
+#include <gtest/gtest.h>
+#include <string>
+
+// Reference values of the xxHash library.
+
+TEST(Xxh64, HashesShortInputs) {
+    EXPECT_EQ(hash::xxh64(""), 0xEF46DB3751D8E999ULL);
+    EXPECT_EQ(hash::xxh64("a"), 0xD24EC4F1A98C6E5BULL);
+    EXPECT_EQ(hash::xxh64("abc"), 0x44BC2CF5AD770999ULL);
+    EXPECT_EQ(hash::xxh64("The quick brown fox jumps over the lazy dog"), 0x0B242D361FDA71BCULL);
+}
+
+TEST(Xxh64, HashesLongInputs) {
+    std::string digits{};
+    for (int i = 0; i < 10; i++) {
+        digits += "0123456789";
+    }
+
+    EXPECT_EQ(hash::xxh64(digits), 0xF80E7B96315AFFFAULL);
+}
+
+TEST(Xxh64, DependsOnSeed) {
+    EXPECT_EQ(hash::xxh64("abc", 1), 0xBEA9CA8199328908ULL);
+}
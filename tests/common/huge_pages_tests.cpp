@@ -0,0 +1,81 @@
+#include "array2d.h"
+#include "huge_pages.h"
+#include <gtest/gtest.h>
+#include <cstring>
+#include <string>
+
+namespace {
+
+    /**
+     * Runs the checks in the given mode and restores the previous one.
+     */
+    template<typename Checks>
+    void withMode(huge_pages::Mode mode, Checks checks) {
+        auto previous = huge_pages::mode();
+        huge_pages::setMode(mode);
+        checks();
+        huge_pages::setMode(previous);
+    }
+
+    size_t backedBytes(const huge_pages::Stats &stats) {
+        return stats.regularBytes + stats.transparentBytes + stats.hugeTlbBytes;
+    }
+
+}
+
+TEST(HugePages, ParsesModes) {
+    EXPECT_EQ(huge_pages::parseMode("off"), huge_pages::Mode::Off);
+    EXPECT_EQ(huge_pages::parseMode("thp"), huge_pages::Mode::Transparent);
+    EXPECT_EQ(huge_pages::parseMode("hugetlb"), huge_pages::Mode::HugeTlb);
+    EXPECT_THROW(huge_pages::parseMode("2mb"), std::invalid_argument);
+}
+
+TEST(HugePages, SmallBlocksAreNotMapped) {
+    withMode(huge_pages::Mode::Transparent, []() {
+        auto before = backedBytes(huge_pages::stats());
+        void *block = huge_pages::allocate(4096);
+        std::memset(block, 1, 4096);
+        huge_pages::deallocate(block, 4096);
+        EXPECT_EQ(backedBytes(huge_pages::stats()), before);
+    });
+}
+
+TEST(HugePages, LargeBlocksAreMappedInWholeHugePages) {
+    for (auto mode: {huge_pages::Mode::Transparent, huge_pages::Mode::HugeTlb}) {
+        withMode(mode, []() {
+            auto before = backedBytes(huge_pages::stats());
+            size_t bytes = huge_pages::HUGE_PAGE_SIZE + 1;
+            auto *block = static_cast<char *>(huge_pages::allocate(bytes));
+            std::memset(block, 1, bytes);
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(block) % huge_pages::HUGE_PAGE_SIZE, 0u);
+            EXPECT_EQ(backedBytes(huge_pages::stats()) - before, 2 * huge_pages::HUGE_PAGE_SIZE);
+
+            // Released by how it was obtained, whatever the mode is now.
+            huge_pages::setMode(huge_pages::Mode::Off);
+            huge_pages::deallocate(block, bytes);
+        });
+    }
+}
+
+TEST(HugePages, OffModeUsesOperatorNew) {
+    withMode(huge_pages::Mode::Off, []() {
+        auto before = backedBytes(huge_pages::stats());
+        HugeArray2D<int> grid(1024, 1024);
+        grid(1023, 1023) = 7;
+        EXPECT_EQ(grid(1023, 1023), 7);
+        EXPECT_EQ(backedBytes(huge_pages::stats()), before);
+    });
+}
+
+TEST(HugePages, AdvisesTheWholeHugePagesOfABuffer) {
+    withMode(huge_pages::Mode::Transparent, []() {
+        std::string buffer{};
+        buffer.reserve(3 * huge_pages::HUGE_PAGE_SIZE);
+        auto backing = huge_pages::advise(buffer.data(), buffer.capacity());
+        EXPECT_NE(backing, huge_pages::Backing::HugeTlb);
+    });
+    withMode(huge_pages::Mode::Off, []() {
+        std::string buffer(3 * huge_pages::HUGE_PAGE_SIZE, 'x');
+        EXPECT_EQ(huge_pages::advise(buffer.data(), buffer.size()), huge_pages::Backing::Regular);
+    });
+}
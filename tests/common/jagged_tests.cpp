@@ -0,0 +1,111 @@
+#include "jagged.h"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+namespace {
+
+    template<typename T, size_t Extent>
+    std::vector<std::remove_const_t<T>> toVector(std::span<T, Extent> values) {
+        return {values.begin(), values.end()};
+    }
+
+}
+
+TEST(Jagged, RecordsAreSpansIntoOneArray) {
+    Jagged<int> jagged{};
+    jagged.push_back({1, 2, 3});
+    jagged.push_back(std::vector<int>{});
+    jagged.push_back({4});
+
+    ASSERT_EQ(jagged.size(), 3u);
+    EXPECT_EQ(jagged.valueCount(), 4u);
+    EXPECT_EQ(toVector(jagged[0]), (std::vector<int>{1, 2, 3}));
+    EXPECT_TRUE(jagged[1].empty());
+    EXPECT_EQ(toVector(jagged.values()), (std::vector<int>{1, 2, 3, 4}));
+    EXPECT_EQ(jagged[2].data(), jagged.values().data() + 3);
+
+    size_t records = 0;
+    for (auto record: jagged) {
+        EXPECT_EQ(record.size(), jagged[records].size());
+        records++;
+    }
+    EXPECT_EQ(records, 3u);
+}
+
+TEST(Jagged, RejectsInconsistentOffsets) {
+    EXPECT_THROW(Jagged<int>({1, 2}, {0, 3}), std::invalid_argument);
+    EXPECT_THROW(Jagged<int>({1, 2}, {0, 2, 1, 2}), std::invalid_argument);
+    EXPECT_NO_THROW(Jagged<int>({1, 2}, {0, 1, 2}));
+}
+
+TEST(Jagged, ParallelBuildKeepsRecordOrder) {
+    // Record i is i % 5 copies of i, across many chunks.
+    auto fill = [](size_t i, std::vector<uint64_t> &values) {
+        for (size_t j = 0; j < i % 5; j++) {
+            values.push_back(i);
+        }
+    };
+    auto jagged = buildJagged<uint64_t>(10007, fill, 64);
+
+    Jagged<uint64_t> expected{};
+    for (size_t i = 0; i < 10007; i++) {
+        std::vector<uint64_t> values{};
+        fill(i, values);
+        expected.push_back(values);
+    }
+    EXPECT_EQ(jagged, expected);
+}
+
+TEST(Jagged, ParallelBuildOfNoRecords) {
+    auto jagged = buildJagged<int>(0, [](size_t, std::vector<int> &) {});
+    EXPECT_TRUE(jagged.empty());
+    EXPECT_EQ(jagged.valueCount(), 0u);
+}
+
+TEST(Jagged, SnapshotRoundTrips) {
+    Jagged<int64_t> jagged{};
+    jagged.push_back({-1, 2});
+    jagged.push_back(std::vector<int64_t>{});
+    jagged.push_back({3, 4, 5});
+
+    std::stringstream snapshot{};
+    jagged.save(snapshot);
+    EXPECT_EQ(Jagged<int64_t>::load(snapshot), jagged);
+}
+
+TEST(Jagged, SnapshotOfAnotherTypeIsRejected) {
+    Jagged<int32_t> jagged{};
+    jagged.push_back({1});
+    std::stringstream snapshot{};
+    jagged.save(snapshot);
+
+    EXPECT_THROW(Jagged<int64_t>::load(snapshot), std::runtime_error);
+    std::stringstream truncated(snapshot.str().substr(0, 20));
+    EXPECT_THROW(Jagged<int32_t>::load(truncated), std::runtime_error);
+}
+
+TEST(Jagged, SnapshotWithCorruptCountsIsRejectedWithoutAllocatingForThem) {
+    Jagged<int32_t> jagged{};
+    jagged.push_back({1, 2});
+    std::stringstream snapshot{};
+    jagged.save(snapshot);
+    auto bytes = snapshot.str();
+    // The header of value size, record count and value count follows the magic.
+    auto headerStart = bytes.size() - 3 * sizeof(uint64_t) - 2 * sizeof(uint64_t) - 2 * sizeof(int32_t);
+
+    for (uint64_t recordCount: {std::numeric_limits<uint64_t>::max(), uint64_t{1} << 60}) {
+        auto corrupt = bytes;
+        std::memcpy(corrupt.data() + headerStart + sizeof(uint64_t), &recordCount, sizeof(recordCount));
+        std::stringstream in(corrupt);
+        EXPECT_THROW(Jagged<int32_t>::load(in), std::runtime_error);
+    }
+    uint64_t valueCount = uint64_t{1} << 60;
+    auto corrupt = bytes;
+    std::memcpy(corrupt.data() + headerStart + 2 * sizeof(uint64_t), &valueCount, sizeof(valueCount));
+    std::stringstream in(corrupt);
+    EXPECT_THROW(Jagged<int32_t>::load(in), std::runtime_error);
+}
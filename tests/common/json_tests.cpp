@@ -0,0 +1,20 @@
+#include "json.h"
+#include <gtest/gtest.h>
+#include <string>
+
+TEST(Json, EscapesQuotesAndBackslashes) {
+    EXPECT_EQ(json::escape("day01 part1"), "day01 part1");
+    EXPECT_EQ(json::escape("say \"hi\" \\ bye"), "say \\\"hi\\\" \\\\ bye");
+}
+
+TEST(Json, EscapesControlCharacters) {
+    EXPECT_EQ(json::escape("line\nnext\r\tend"), "line\\nnext\\r\\tend");
+    EXPECT_EQ(json::escape(std::string("\x01\x1f\0", 3)), "\\u0001\\u001f\\u0000");
+    // Bytes of UTF-8 sequences are above 0x7f and stay as they are.
+    EXPECT_EQ(json::escape("\xc3\xa9\x7f"), "\xc3\xa9\x7f");
+}
+
+TEST(Json, Quotes) {
+    EXPECT_EQ(json::quote(""), "\"\"");
+    EXPECT_EQ(json::quote("a\"b"), "\"a\\\"b\"");
+}
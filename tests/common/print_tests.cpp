@@ -1,8 +1,10 @@
 
 #include "print.h"
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <ostream>
 #include <string_view>
+#include <unistd.h>
 
 using namespace std::literals::string_view_literals;
 
@@ -72,4 +74,52 @@ TEST(PrintVector, PrintsVectorOfCustomType) {
     EXPECT_STREQ(output.c_str(), "[CustomType(name=\"foo\"),"
                                  "CustomType(name=\"bar\"),"
                                  "CustomType(name=\"baz\")]");
-}
\ No newline at end of file
+}
+
+enum class Tile : uint8_t { Floor, Wall };
+
+std::ostream &operator<<(std::ostream &out, const Tile &tile) {
+    return out << (tile == Tile::Wall ? '#' : '.');
+}
+
+TEST(RenderGrid, RendersOneLinePerRow) {
+    Array2D<Tile> grid(2, 3);
+    grid(0, 1) = Tile::Wall;
+    grid(1, 2) = Tile::Wall;
+
+    EXPECT_EQ(renderGrid(grid), ".#.\n..#\n");
+}
+
+TEST(RenderGrid, RendersNumbersAsDigits) {
+    Array2D<int> grid(1, 4);
+    grid(0, 1) = 1;
+    grid(0, 2) = 9;
+    grid(0, 3) = 10;
+
+    EXPECT_EQ(renderGrid(grid), ".19#\n");
+}
+
+TEST(GridRenderer, DrawsOnlyChangedCellsOfNextFrame) {
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+    GridRenderer<char> renderer(fds[1], true);
+    Array2D<char> grid(2, 3);
+    std::fill(grid.begin(), grid.end(), '.');
+
+    renderer.render(grid);
+    grid(1, 1) = '@';
+    grid(1, 2) = '@';
+    renderer.render(grid);
+    close(fds[1]);
+
+    std::string output{};
+    char buffer[256];
+    ssize_t count;
+    while ((count = read(fds[0], buffer, sizeof(buffer))) > 0) {
+        output.append(buffer, count);
+    }
+    close(fds[0]);
+
+    EXPECT_EQ(output, "\x1b[2J\x1b[H...\n...\n\x1b[3;1H"
+                      "\x1b[2;2H@@\x1b[3;1H");
+}
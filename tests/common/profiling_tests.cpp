@@ -0,0 +1,50 @@
+#include "profiling.h"
+#include <gtest/gtest.h>
+#include <sstream>
+
+namespace {
+
+    /**
+     * Runs the checks with profiling on or off and an empty registry, and restores the setting.
+     */
+    template<typename Checks>
+    void withProfiling(bool enabled, Checks checks) {
+        auto previous = profiling::enabled();
+        profiling::setEnabled(enabled);
+        profiling::reset();
+        checks();
+        profiling::reset();
+        profiling::setEnabled(previous);
+    }
+
+}
+
+TEST(Profiling, AddsUpZonesOfTheSameName) {
+    withProfiling(true, []() {
+        for (int i = 0; i < 3; i++) {
+            AOC_PROFILE_ZONE("parse");
+        }
+        {
+            AOC_PROFILE_ZONE("part 1");
+        }
+        auto zones = profiling::zones();
+        ASSERT_EQ(zones.size(), 2u);
+        for (const auto &zone: zones) {
+            EXPECT_EQ(zone.calls, zone.name == "parse" ? 3u : 1u);
+        }
+
+        std::ostringstream report{};
+        profiling::report(report);
+        EXPECT_NE(report.str().find("[Profile] parse: 3 calls, "), std::string::npos);
+        EXPECT_NE(report.str().find("[Profile] part 1: 1 call, "), std::string::npos);
+    });
+}
+
+TEST(Profiling, RecordsNothingWhileDisabled) {
+    withProfiling(false, []() {
+        {
+            AOC_PROFILE_ZONE("parse");
+        }
+        EXPECT_TRUE(profiling::zones().empty());
+    });
+}
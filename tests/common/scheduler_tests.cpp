@@ -0,0 +1,78 @@
+#include "scheduler.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+    /**
+     * Runs the checks with the given options and restores the previous ones.
+     */
+    template<typename Checks>
+    void withOptions(const scheduler::Options &options, Checks checks) {
+        auto previous = scheduler::options();
+        scheduler::configure(options);
+        checks();
+        scheduler::configure(previous);
+    }
+
+}
+
+TEST(Scheduler, ParallelForVisitsEveryIndexOnce) {
+    std::vector<std::atomic<int>> visits(1000);
+    scheduler::parallelFor(size_t{0}, visits.size(), [&visits](size_t i) { visits[i]++; }, 16);
+
+    for (const auto &count: visits) {
+        EXPECT_EQ(count.load(), 1);
+    }
+}
+
+TEST(Scheduler, ParallelReduceSumsMappedValues) {
+    auto sum = scheduler::parallelReduce(int64_t{1}, int64_t{100001}, int64_t{0},
+                                         [](int64_t i) { return i; },
+                                         [](int64_t a, int64_t b) { return a + b; }, 128);
+    EXPECT_EQ(sum, 5000050000);
+}
+
+TEST(Scheduler, ParallelCountOnEmptyRange) {
+    EXPECT_EQ(scheduler::parallelCount(0, 0, [](int) { return true; }), 0u);
+}
+
+TEST(Scheduler, DeterministicReductionIsReproducible) {
+    withOptions({.concurrency = 4, .deterministic = true}, []() {
+        auto sumOfInverses = []() {
+            return scheduler::parallelReduce(1, 200000, 0.0, [](int i) { return 1.0 / i; },
+                                             [](double a, double b) { return a + b; }, 64);
+        };
+        auto first = sumOfInverses();
+        for (int run = 0; run < 10; run++) {
+            EXPECT_EQ(sumOfInverses(), first);
+        }
+    });
+}
+
+TEST(Scheduler, ConcurrencyFollowsTheLimit) {
+    withOptions({.concurrency = 2}, []() {
+        EXPECT_EQ(scheduler::concurrency(), 2);
+    });
+}
+
+TEST(Scheduler, PerWorkerScratchIsSeparate) {
+    scheduler::PerWorker<std::vector<int>> scratch{};
+    scheduler::parallelFor(0, 10000, [&scratch](int i) { scratch.local().push_back(i); }, 32);
+
+    size_t total = 0;
+    scratch.forEach([&total](const std::vector<int> &values) { total += values.size(); });
+    EXPECT_EQ(total, 10000u);
+}
+
+TEST(Scheduler, TaskGroupRunsAllTasks) {
+    std::atomic<int> done{0};
+    scheduler::TaskGroup group{};
+    for (int i = 0; i < 8; i++) {
+        group.run([&done]() { done++; });
+    }
+    group.wait();
+    EXPECT_EQ(done.load(), 8);
+}
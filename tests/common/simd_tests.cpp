@@ -0,0 +1,107 @@
+#include "simd.h"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+    std::vector<simd::Isa> supportedIsas() {
+        std::vector<simd::Isa> isas{};
+        for (auto isa: {simd::Isa::Scalar, simd::Isa::Avx2, simd::Isa::Avx512}) {
+            if (isa <= simd::detectedIsa()) {
+                isas.push_back(isa);
+            }
+        }
+        return isas;
+    }
+
+    /**
+     * Runs the checks with every ISA the host supports and restores the active one.
+     */
+    template<typename Checks>
+    void forEachIsa(Checks checks) {
+        auto active = simd::activeIsa();
+        for (auto isa: supportedIsas()) {
+            SCOPED_TRACE(simd::name(isa));
+            simd::forceIsa(isa);
+            checks();
+        }
+        simd::forceIsa(active);
+    }
+
+}
+
+TEST(Simd, FindsBytesAtAnyPosition) {
+    // Lengths around the vector widths exercise the loops and the tails.
+    for (size_t length: {0, 1, 31, 32, 33, 63, 64, 65, 200}) {
+        std::string text(length, '.');
+        forEachIsa([&]() {
+            EXPECT_EQ(simd::findByte(text, '\n'), std::string::npos);
+        });
+        for (size_t position = 0; position < length; position++) {
+            text[position] = '\n';
+            forEachIsa([&]() {
+                EXPECT_EQ(simd::findByte(text, '\n'), position);
+                EXPECT_EQ(simd::findByte(text, '\n', position + 1), std::string::npos);
+            });
+            text[position] = '.';
+        }
+    }
+}
+
+TEST(Simd, CountsBytes) {
+    std::mt19937 random(7);
+    std::string text(1000, '.');
+    size_t expected = 0;
+    for (auto &character: text) {
+        if (random() % 5 == 0) {
+            character = '#';
+            expected++;
+        }
+    }
+    forEachIsa([&]() {
+        for (size_t length: {0, 1, 33, 64, 65, 1000}) {
+            auto prefix = std::string_view(text).substr(0, length);
+            EXPECT_EQ(simd::countByte(prefix, '#'), std::count(prefix.begin(), prefix.end(), '#'));
+        }
+        EXPECT_EQ(simd::countByte(text, '#'), expected);
+    });
+}
+
+TEST(Simd, SumsWithoutOverflow) {
+    std::vector<int32_t> values(1001, INT32_MAX);
+    values[3] = INT32_MIN;
+    int64_t expected = 1000LL * INT32_MAX + INT32_MIN;
+    forEachIsa([&]() {
+        EXPECT_EQ(simd::sum(values), expected);
+        EXPECT_EQ(simd::sum(std::span(values).first(5)), 4LL * INT32_MAX + INT32_MIN);
+    });
+}
+
+TEST(Simd, SumsWideValuesExactly) {
+    std::vector<int64_t> values(1003, INT64_MAX);
+    values[5] = INT64_MIN;
+    values[6] = -7;
+    __int128 expected = 1001 * static_cast<__int128>(INT64_MAX) + INT64_MIN - 7;
+    std::vector<int64_t> negatives(37, INT64_MIN);
+    forEachIsa([&]() {
+        EXPECT_TRUE(simd::sum(values) == expected);
+        EXPECT_TRUE(simd::sum(negatives) == 37 * static_cast<__int128>(INT64_MIN));
+        EXPECT_TRUE(simd::sum(std::span(values).first(3)) == 3 * static_cast<__int128>(INT64_MAX));
+        EXPECT_TRUE(simd::sum(std::span<const int64_t>{}) == 0);
+    });
+}
+
+TEST(Simd, CountsSetBits) {
+    std::vector<uint64_t> words{~0ULL, 1, 0, 0x8000000000000001ULL, 0xF0};
+    forEachIsa([&]() {
+        EXPECT_EQ(simd::popcount(words), 64u + 1 + 0 + 2 + 4);
+    });
+}
+
+TEST(Simd, RejectsUnknownIsaNames) {
+    EXPECT_EQ(simd::parseIsa("avx2"), simd::Isa::Avx2);
+    EXPECT_THROW(simd::parseIsa("neon"), std::invalid_argument);
+}
@@ -0,0 +1,89 @@
+#include "small_vector.h"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    template<typename T, std::size_t N>
+    std::vector<T> toVector(const SmallVector<T, N> &values) {
+        return {values.begin(), values.end()};
+    }
+
+}
+
+TEST(SmallVector, StaysInlineUpToItsCapacity) {
+    SmallVector<int, 4> values{};
+    for (int i = 0; i < 4; i++) {
+        values.push_back(i);
+    }
+    EXPECT_TRUE(values.isSmall());
+    EXPECT_EQ(toVector(values), (std::vector<int>{0, 1, 2, 3}));
+}
+
+TEST(SmallVector, GrowsOntoTheHeap) {
+    SmallVector<uint64_t, 4> values{};
+    for (uint64_t i = 0; i < 100; i++) {
+        values.push_back(i * i);
+    }
+    EXPECT_FALSE(values.isSmall());
+    ASSERT_EQ(values.size(), 100u);
+    EXPECT_EQ(values[99], 99u * 99u);
+}
+
+TEST(SmallVector, PushBackOfOwnElementWhileGrowing) {
+    SmallVector<int, 2> values{7, 8};
+    values.push_back(values[0]);
+    EXPECT_EQ(toVector(values), (std::vector<int>{7, 8, 7}));
+}
+
+TEST(SmallVector, CopiesAndMovesInlineAndHeapStorage) {
+    for (size_t count: {3u, 30u}) {
+        SmallVector<int, 8> original{};
+        for (size_t i = 0; i < count; i++) {
+            original.push_back(static_cast<int>(i));
+        }
+
+        SmallVector<int, 8> copy = original;
+        EXPECT_EQ(copy, original);
+
+        SmallVector<int, 8> moved = std::move(copy);
+        EXPECT_EQ(moved, original);
+        EXPECT_TRUE(copy.empty());
+
+        SmallVector<int, 8> assigned{1};
+        assigned = moved;
+        EXPECT_EQ(assigned, original);
+        assigned = std::move(moved);
+        EXPECT_EQ(assigned, original);
+    }
+}
+
+TEST(SmallVector, EraseShiftsTheTail) {
+    SmallVector<int, 4> values{1, 2, 3, 4, 5};
+    auto next = values.erase(values.begin() + 1);
+    EXPECT_EQ(*next, 3);
+    EXPECT_EQ(toVector(values), (std::vector<int>{1, 3, 4, 5}));
+    values.erase(values.end() - 1);
+    EXPECT_EQ(toVector(values), (std::vector<int>{1, 3, 4}));
+}
+
+TEST(SmallVector, ResizeFillsNewElements) {
+    SmallVector<int, 2> values{5};
+    values.resize(4, 9);
+    EXPECT_EQ(toVector(values), (std::vector<int>{5, 9, 9, 9}));
+    values.resize(1);
+    EXPECT_EQ(toVector(values), (std::vector<int>{5}));
+    EXPECT_THROW(values.at(1), std::out_of_range);
+}
+
+TEST(SmallVector, CountAndValueOfTheElementType) {
+    // Two ints are a count and a value, as for std::vector, not an iterator range.
+    SmallVector<int, 4> values(3, 5);
+    EXPECT_EQ(toVector(values), (std::vector<int>{5, 5, 5}));
+
+    std::vector<int> source{1, 2, 3, 4, 5};
+    SmallVector<int, 4> copied(source.begin(), source.end());
+    EXPECT_EQ(toVector(copied), source);
+}